@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/30 14:36:49 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/16 10:57:47 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 03:29:06 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,22 +15,95 @@
 
 # define _GNU_SOURCE
 # define MAX_DEPTH 6
+
+// BVH build and traversal parameters
+# define BVH_TRAV_COST 1.0		// cost of a box test vs. 1.0 per primitive
+# define BVH_MAX_LEAF 4			// larger leaves are always split
+# define BVH_MAX_SAH_DEPTH 64	// deeper nodes are just cut in halves
+# define BVH_STACK_SIZE 128		// traversal stack, > max depth of the tree
+# define BVH_BINS 16			// SAH candidates per axis and node
+# define BVH_TASK_SIZE 4096		// nodes this small are built as one task
+# define BVH_PAR_BIN_SIZE 65536	// nodes this large are binned in parallel
+# define BVH_REBUILD_RATIO 1.3	// refits may let the SAH cost grow that much
+# define LBVH_MORTON_BITS 10		// per axis: 30-bit Morton codes
+# define LBVH_RADIX_BITS 8		// the codes are sorted 8 bits at a time
+# define LBVH_RADIX 256			// buckets per pass: 1 << LBVH_RADIX_BITS
+# define LBVH_SORT_SIZE 16384	// fewer primitives are sorted on one thread
+# define LBVH_MAX_LEAF 1			// larger ranges are always split
+# define ANIM_STRIDE 32			// --animate moves 1 object out of 32 (--stride)
+# define ANIM_SPEED 0.002		// per frame, relative to the scene's size
+# define GRID_DENSITY 3.0		// uniform grid: cells per object
+# define GRID_MAX_RES 512		// cells per axis, at most
+# define GRID_HASH_CELL 2.0		// hashed grid: cell size / mean object size
+# define GRID_MAX_REFS 33554432	// coarser grid beyond that many references
+# define GRID_BLOCK 16			// an empty block of 16^3 cells: crossed at once
+# define RT_MAX_THREADS 256
+# define CACHE_SUFFIX ".cache"	// scene.rt -> scene.rt.cache
+# define CACHE_MAGIC "miniRTc"
+# define CACHE_VERSION 5		// bump when the cached data changes meaning
+# define CACHE_ALIGN 16
+# define PERF_COUNTERS 3		// hardware counters read by --bench
+# define LIGHT_LANES 4			// lights shaded at once: 4 doubles of AVX
+# define SHADOW_BENCH_RAYS 262144	// shadow rays replayed by --bench
+# define KERNEL_BENCH_RAYS 65536	// most camera rays of the kernel --bench
+# define KERNEL_BENCH_TESTS 4194304	// primitive tests timed per kernel
+# define WBVH_MAX 8				// children per node of the wide BVHs
+# define WBVH_STACK_SIZE 1024	// > (WBVH_MAX - 1) * max depth of the tree
+# define PACKET_SIZE 4			// camera rays traced in 4x4 packets (--packet)
+# define PACKET_MAX 64			// camera rays traced together: 8x8 at most
+# define RENDER_TILE 32			// pixels per side of the tiles of the threads
+# define DISPLAY_HZ 30			// window refreshes per second while rendering
+# define DIFF_VISIBLE 8			// --diff: channel difference counted as visible
 # include <math.h>
-# include <float.h> // for DBL_MAX
+# include <float.h> // for DBL_MAX, FLT_MAX
 # include <stdlib.h>
 # include <stdio.h>
 # include <unistd.h>
 # include <fcntl.h>
+# include <time.h>
+# include <pthread.h>
+# include <sys/resource.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
+# include <stddef.h>
 
 # include "libft.h"
 # include "mlx.h"
 
+// The scalar type of the geometry, the rays and the shading: double, or
+// float with `make PRECISION=float` (MINIRT_FLOAT). HIT_EPS is how far a hit
+// must be along a ray, and how far the secondary rays start off a surface:
+// it has to exceed the rounding error of a hit point, which grows with the
+// unit roundoff of the type (see README). PARALLEL_EPS: |d · n| under which
+// a ray is taken as parallel to a plane.
+# ifdef MINIRT_FLOAT
+typedef float		t_real;
+#  define REAL_MAX FLT_MAX
+#  define HIT_EPS 2e-3
+#  define PARALLEL_EPS 1e-5
+# else
+typedef double		t_real;
+#  define REAL_MAX DBL_MAX
+#  define HIT_EPS 1e-3
+#  define PARALLEL_EPS 1e-6
+# endif
+
+// @bonus The SIMD kernels of the primitives and of the lights work on
+// doubles: they are built on x86-64, for the double render path only. The
+// float build tests the primitives and shades the lights one at a time.
+# if defined(__x86_64__) && !defined(MINIRT_FLOAT)
+#  define SIMD_KERNELS
+# endif
+
 // Using t_vec3 for points, vectors, and colors for simplicity
 typedef struct s_vec3
 {
-	double			x;
-	double			y;
-	double			z;
+	t_real			x;
+	t_real			y;
+	t_real			z;
 }					t_vec3;
 
 typedef t_vec3	t_point3;	// alias for 3D point
@@ -48,13 +121,13 @@ typedef struct s_camera
 {
 	t_point3		origin;	// The camera's position (parsed 'C' coordinates)
 	t_vec3			orientation;	// The point the camera is looking at
-	double			fov;	// Horizontal field of view in degrees
+	t_real			fov;	// Horizontal field of view in degrees
 	// --- Pre-calculated values for rendering ---
 	t_vec3			u;		// Camera coordinate system basis vectors
 	t_vec3			v;		// Camera coordinate system basis vectors
 	t_vec3			w;		// Camera coordinate system basis vectors
-	double			viewport_height;
-	double			viewport_width;
+	t_real			viewport_height;
+	t_real			viewport_width;
 	t_vec3			viewport_u;	// Horizontal vector of the viewport
 	t_vec3			viewport_v;	// Vertical vector of the viewport
 	t_vec3			pixel_delta_u;	// delta pixel vector (horizontal)
@@ -66,11 +139,23 @@ typedef struct s_camera
 typedef struct s_light
 {
 	t_point3		position; // Parsed 'L' coordinates
-	double			ratio;	// Light brightness ratio (0.0 - 1.0)
+	t_real			ratio;	// Light brightness ratio (0.0 - 1.0)
 	t_color			color;	// Parsed 'L' color (0-255 range), used at bonus
 	struct s_light	*next;
 }					t_light;
 
+// @bonus The lights in flat arrays (see light_compile()), x, y and z apart,
+// with their color already multiplied by their ratio. The arrays are
+// padded to a multiple of LIGHT_LANES with black lights.
+typedef struct s_light_soa
+{
+	int				count;
+	t_real			*pos[3];
+	t_real			*rgb[3];
+	t_real			*block;			// the 6 arrays
+	int				simd;			// t_simd_level of the shading kernel
+}					t_light_soa;
+
 // Generic object structure with type and data pointer
 // This simplifies storage and traversal
 typedef enum e_obj_type
@@ -78,7 +163,8 @@ typedef enum e_obj_type
 	SPHERE,
 	PLANE,
 	CYLINDER,
-	CONE
+	CONE,
+	INSTANCE
 }					t_obj_type;
 
 // Checker vs Mirror pattern in the .rt config files
@@ -94,8 +180,8 @@ typedef struct s_object
 	t_obj_type		type;
 	t_color			color;	// Parsed object color (0-255 range)
 	// --- specular data ---
-	double			speci;	// specular intensity [0-1] range @bonus prop
-	double			shine;	// specular blur, 1 blurred, 100 sharp,
+	t_real			speci;	// specular intensity [0-1] range @bonus prop
+	t_real			shine;	// specular blur, 1 blurred, 100 sharp,
 							//						1000 mirror @bonus prop
 	// --- checkerboard pattern ---
 	int				checker;		// flag,
@@ -103,19 +189,21 @@ typedef struct s_object
 									//		1: checkerboard pattern
 									//		2: reflectivity
 	t_color			color2;			// the second color of the pattern
-	double			pattern_scale;	// the size of the checker squares
+	t_real			pattern_scale;	// the size of the checker squares
 	// --- reflectivity ---
-	double			reflect;	// reflectivity in [0-1] range
+	t_real			reflect;	// reflectivity in [0-1] range
 								// 0: no reflection, 1: perfect mirror
 	// --- pointer to object specific shape data and to the next object
 	void			*shape_data; // Pointer to one of the structs below
 	struct s_object	*next;
+	int				prim;	// @bonus its index in its accel (see t_prim_soa)
 }					t_object;
 
 typedef struct s_sphere
 {
 	t_point3		center; // Parsed 'sp' coordinates
-	double			radius;	// Parsed 'sp' diameter / 2
+	t_real			radius;	// Parsed 'sp' diameter / 2
+	t_real			radius_sq;	// radius², see shape_prepare()
 }					t_sphere;
 
 typedef struct s_plane
@@ -130,32 +218,474 @@ typedef struct s_cylinder
 	t_point3		center; // Center of the cylinder base (parsed 'cy' coords)
 	t_vec3			axis;	// Axis vector (parsed 'cy' orientation vector,
 							// should be normalized)
-	double			diameter; // Parsed 'cy' diameter
-	double			height;	// Parsed 'cy' height
+	t_real			diameter; // Parsed 'cy' diameter
+	t_real			height;	// Parsed 'cy' height
+	t_real			radius_sq;	// radius², see shape_prepare()
+	t_point3		top;	// center of the top cap
+	t_real			bound_mid;	// @bonus center of the bounding sphere,
+	t_real			bound_sq;	// along the axis, and its squared radius
 }					t_cylinder;
 
 typedef struct s_cone
 {
 	t_point3		tip;	// the apex point of the cone
 	t_vec3			axis;	// the normalized direction of the cone's axis
-	double			height;	// the height for a finite cone
-	double			angle;	// angle in degrees
-	double			cos_angle_sq;	// pre-calculated cos^2 of the cone's
+	t_real			height;	// the height for a finite cone
+	t_real			angle;	// angle in degrees
+	t_real			cos_angle_sq;	// pre-calculated cos^2 of the cone's
 																// half angle
+	t_real			inv_cos_sq;	// 1 / cos², see shape_prepare()
+	t_point3		base;	// center of the base cap
+	t_real			cap_r_sq;	// radius² of the base cap
+	t_real			bound_mid;	// @bonus center of the bounding sphere,
+	t_real			bound_sq;	// along the axis, and its squared radius
 }					t_cone;
 
+// @bonus Per object type: how many times prim_hit() tested one, how many
+// of those its bounding sphere rejected at once, and how many were hits;
+// and the closest-hit and any-hit queries of the scene
+typedef struct s_prim_stats
+{
+	long			tests[INSTANCE + 1];
+	long			culled[INSTANCE + 1];
+	long			hits[INSTANCE + 1];
+	long			rays;
+	long			shadow_rays;
+}					t_prim_stats;
+
+// @bonus The shading data of an object, copied out of its t_object by the
+// scene compile (see prim_compile())
+typedef struct s_material
+{
+	t_color			color;
+	t_color			color2;
+	t_real			pattern_scale;
+	t_real			speci;
+	t_real			shine;
+	t_real			reflect;
+	int				checker;
+}					t_material;
+
+// @bonus Structures of arrays, one per object type: entry k of every array
+// belongs to the k-th object of that type. The 3D points and vectors are
+// split into their x, y and z arrays.
+typedef struct s_sphere_soa
+{
+	double			*center[3];
+	double			*radius;
+	double			*radius_sq;
+}					t_sphere_soa;
+
+typedef struct s_plane_soa
+{
+	double			*point[3];
+	double			*normal[3];
+}					t_plane_soa;
+
+typedef struct s_cylinder_soa
+{
+	double			*center[3];
+	double			*axis[3];
+	double			*diameter;
+	double			*height;
+	double			*radius_sq;
+	double			*top[3];
+	double			*bound[4];		// its bounding sphere, for the kernels
+}					t_cylinder_soa;
+
+typedef struct s_cone_soa
+{
+	double			*tip[3];
+	double			*axis[3];
+	double			*height;
+	double			*cos_angle_sq;
+	double			*inv_cos_sq;
+	double			*base[3];
+	double			*cap_r_sq;
+	double			*bound[4];		// its bounding sphere, for the kernels
+}					t_cone_soa;
+
+// @bonus The primitives of an accel compiled for the traversals: primitive
+// i is acc->prims[i], or the plane acc->planes[i - prim_count]. Its type,
+// its slot in the arrays of that type and its material sit in flat arrays.
+// So does its bounding sphere, the first thing a ray tests (prim_culled()):
+// a leaf's primitives are next to each other in acc->prims, their spheres
+// are read from a few cache lines. All the doubles are in one block.
+typedef struct s_prim_soa
+{
+	int				total;			// prim_count + plane_count
+	unsigned char	*type;			// t_obj_type of each primitive
+	int				*slot;			// its entry in the arrays of its type
+	t_material		*mat;			// its material
+	int				count[INSTANCE + 1];	// primitives of each type
+	double			*block;			// the arrays of doubles below
+	double			*bound[4];		// bounding sphere: x, y, z, radius²
+	t_sphere_soa	sp;
+	t_plane_soa		pl;
+	t_cylinder_soa	cy;
+	t_cone_soa		co;
+	int				simd;			// t_simd_level of the kernels
+}					t_prim_soa;
+
+// @bonus A ray as the SIMD kernels take it (see kernel_bonus.c)
+typedef struct s_kernel_ray
+{
+	double			o[3];			// origin
+	double			d[3];			// direction
+	double			dd;				// |d|²
+	double			two_a;			// 2 * |d|²
+	double			four_a;			// 4 * |d|²
+	int				type;			// t_obj_type of the run
+	int				any;			// stop at the first primitive hit
+}					t_kernel_ray;
+
+// Axis-aligned bounding box, used by the acceleration structures
+typedef struct s_aabb
+{
+	t_point3		min;
+	t_point3		max;
+}					t_aabb;
+
+// A node of the flattened bounding volume hierarchy (nodes[0] is the root)
+//	inner node:	`left_first` is the index of the left child, the right child
+//				is stored right after it (left_first + 1), `count` is 0
+//	leaf:		`left_first` is the index of the first primitive in
+//				accel->prims, `count` is the number of primitives in it
+typedef struct s_bvh_node
+{
+	t_aabb			box;
+	int				left_first;
+	int				count;
+}					t_bvh_node;
+
+// Uniform grid over the bounded objects (--accel grid / hgrid): an object is
+// referenced by every cell its box overlaps. The plain grid stores every
+// cell, the hashed one only those holding something, in an open addressing
+// hash table keyed by the cell index.
+// Both keep one byte per block of GRID_BLOCK^3 cells, set if any cell of the
+// block holds something: a ray crosses an empty block in one step.
+typedef struct s_grid_slot
+{
+	long			key;			// the cell, -1 if the slot is free
+	int				start;			// first item of the cell
+	int				count;			// number of items of the cell
+}					t_grid_slot;
+
+typedef struct s_grid
+{
+	t_aabb			box;			// bounds of all the objects
+	int				res[3];			// cells per axis
+	t_vec3			cell;			// size of a cell
+	int				*items;			// indices into acc->prims, cell by cell
+	long			item_count;
+	int				*start;			// grid: first item of each cell (+ end)
+	t_grid_slot		*slots;			// hgrid: the hash table of the cells
+	long			hash_mask;		// hgrid: number of slots - 1
+	long			cell_count;		// cells holding at least one object
+	unsigned char	*blocks;		// 1 for the blocks holding something
+	int				bres[3];		// blocks per axis
+}					t_grid;
+
+// Which structure answers the closest-hit / any-hit queries of the renderer
+typedef enum e_accel_kind
+{
+	ACCEL_LINEAR = 0,
+	ACCEL_BVH = 1,
+	ACCEL_BVH4 = 2,
+	ACCEL_BVH8 = 3,
+	ACCEL_GRID = 4,
+	ACCEL_HGRID = 5,
+	ACCEL_QBVH8 = 6,
+	ACCEL_QBVH16 = 7
+}					t_accel_kind;
+
+// Instruction set used for the box tests of the wide BVHs, the shading and
+// the primitive kernels: 1 << level doubles at once
+typedef enum e_simd_level
+{
+	SIMD_NONE = 0,
+	SIMD_SSE = 1,
+	SIMD_AVX = 2,
+	SIMD_AVX512 = 3		// AVX-512F, the primitive kernels only
+}					t_simd_level;
+
+// How the binary BVH is built (--build)
+//	BUILD_SAH:		top-down, binned surface area heuristic (best trees)
+//	BUILD_LBVH:		linear BVH, split on the Morton codes of the centroids
+//					(about 10x faster, for the trees rebuilt every frame)
+//	BUILD_LBVH_OPT:	LBVH improved by tree rotations (a bit slower)
+typedef enum e_bvh_builder
+{
+	BUILD_SAH = 0,
+	BUILD_LBVH = 1,
+	BUILD_LBVH_OPT = 2
+}					t_bvh_builder;
+
+// A node of the wide BVH (BVH4 / BVH8), collapsed from the binary tree.
+// The boxes of its children are stored as a structure of arrays in floats
+// (rounded outwards), so that one ray tests 4 (SSE) or 8 (AVX) of them in
+// a single go. Only the first `used` lanes hold a child.
+//	child[i]:	inner child: index of its wide node
+//				leaf child: index of its first primitive in acc->prims
+//	count[i]:	number of primitives of a leaf child, 0 for an inner child
+typedef struct s_wbvh_node
+{
+	float			bmin[3][WBVH_MAX];	// [axis][child] lower corners
+	float			bmax[3][WBVH_MAX];	// [axis][child] upper corners
+	int				child[WBVH_MAX];
+	int				count[WBVH_MAX];
+	int				used;
+}					t_wbvh_node;
+
+// A node of the quantized BVH (--accel qbvh8 / qbvh16), made from an inner
+// node of the binary tree: it holds the boxes of its two children, as
+// integers of 8 or 16 bits on a lattice of 2^bits - 1 steps spanning the
+// box of the node itself (decoded from its parent's, the root box is kept
+// in doubles). They are rounded outwards: a decoded box always contains the
+// exact one. The binary tree is freed once quantized.
+//	child[i]:	inner child: index of its node
+//				leaf child: index of its first primitive in acc->prims
+//	count[i]:	primitives of a leaf child, 0 for an inner child, -1 for no
+//				child at all (the root node of a tree that is a single leaf)
+//	q[]:		min x, y, z then max x, y, z of child 0, then of child 1,
+//				12 bytes for 8 bits, 24 bytes for 16 bits
+typedef struct s_qbvh_node
+{
+	int				child[2];
+	short			count[2];
+	unsigned char	q[];
+}					t_qbvh_node;
+
+// The acceleration structure, built once right after parsing.
+// Planes are unbounded, they can't go into a bounding volume, so they are
+// kept aside and tested for every ray (a scene only has a handful of them)
+typedef struct s_accel
+{
+	t_accel_kind	kind;
+	t_bvh_builder	builder;		// how the binary BVH is built
+	t_object		**prims;		// bounded objects, in BVH leaf order
+	int				prim_count;
+	t_object		**planes;		// unbounded objects (planes)
+	int				plane_count;
+	t_bvh_node		*nodes;
+	int				node_count;
+	t_wbvh_node		*wnodes;		// --accel bvh4 / bvh8 only
+	int				wnode_count;
+	int				width;			// children per wide node: 4 or 8
+	t_simd_level	simd;			// box test of the wide nodes
+	t_grid			*grid;			// --accel grid / hgrid only
+	char			*qnodes;		// --accel qbvh8 / qbvh16 only
+	int				qnode_count;
+	int				qbits;			// bits per quantized coordinate: 8 or 16
+	t_aabb			qroot;			// box of the root of the quantized BVH
+	double			build_ms;		// time spent in accel_create()
+	int				build_threads;	// threads used by the BVH build
+	int				*parents;		// parent of each node, for refits only
+	int				*leaf_of;		// leaf of each primitive, for refits only
+	double			sah_area;		// SAH cost of the tree * area of the root
+	double			sah_built;		// SAH cost right after the last build
+	int				refits;			// accel_update() calls that refitted
+	int				rebuilds;		// and those that rebuilt the tree
+	t_prim_soa		soa;			// the primitives, compiled
+}					t_accel;
+
+// State of a single ray walking down the quantized BVH: every node on the
+// stack comes with its decoded box, the boxes of its children depend on it
+typedef struct s_qbvh_trav
+{
+	t_ray			*ray;
+	t_vec3			inv_dir;
+	t_real			t_max;
+	int				stack[BVH_STACK_SIZE];
+	t_real			dist[BVH_STACK_SIZE];
+	t_aabb			box[BVH_STACK_SIZE];
+	int				sp;
+}					t_qbvh_trav;
+
+// 3D-DDA walk of a ray through the cells of a grid (Amanatides & Woo)
+typedef struct s_grid_trav
+{
+	t_ray			*ray;
+	int				cell[3];		// current cell
+	int				step[3];		// +1 / -1: direction of the walk
+	t_real			t_next[3];		// distance to the next cell on each axis
+	t_real			t_delta[3];		// distance across a cell on each axis
+	t_real			t_max;			// closest hit so far / shadow ray length
+}					t_grid_trav;
+
+// A node to build: its index, its range of primitives and its depth
+typedef struct s_bvh_range
+{
+	int				node;
+	int				first;
+	int				count;
+	int				depth;
+}					t_bvh_range;
+
+// A subtree built by one thread into its own node buffer.
+// The top of the tree is a task too, built first and straight into
+// acc->nodes: its nodes of <= BVH_TASK_SIZE primitives become new tasks.
+typedef struct s_bvh_task
+{
+	t_bvh_range		range;		// range.node: its slot in the final tree
+	t_bvh_node		*nodes;		// nodes of the subtree, its root first
+	int				node_count;
+	int				spawn;		// 1 for the top of the tree only
+}					t_bvh_task;
+
+// Scratch data of the BVH build, freed once the tree is done
+typedef struct s_bvh_build
+{
+	t_accel			*acc;
+	t_aabb			*boxes;		// bounds of each primitive
+	t_point3		*centroids;	// center of each primitive's bounds
+	int				*idx;		// primitive indices, reordered by the build
+	unsigned int	*codes;		// LBVH: Morton code of idx[i], sorted
+	t_bvh_task		*tasks;		// subtrees left to build, in tree order
+	int				task_count;
+	int				task_max;
+	int				next_task;	// next task to hand out (atomic)
+	int				failed;		// set by a worker on allocation failure
+	int				threads;
+}					t_bvh_build;
+
+// A SAH bin: the primitives whose centroid falls into a slice of the node
+typedef struct s_bvh_bin
+{
+	t_aabb			box;
+	int				count;
+}					t_bvh_bin;
+
+// Primitives of a node, binned along the three axes
+typedef struct s_bvh_binning
+{
+	t_bvh_build		*b;
+	int				first;		// range of primitives to bin
+	int				count;
+	t_point3		cmin;		// lower corner of the centroid bounds
+	t_vec3			scale;		// BVH_BINS / centroid extent, 0 if flat
+	t_bvh_bin		bins[3][BVH_BINS];
+}					t_bvh_binning;
+
+// Best split found by the surface area heuristic for a node
+//	axis -1:	no usable plane, the range is simply cut in two halves
+typedef struct s_bvh_split
+{
+	int				axis;	// 0: x, 1: y, 2: z
+	int				bin;	// bins [0, bin) go to the left child
+	int				left_count;	// number of primitives of the left child
+	double			cost;	// SAH cost of the split
+	double			cmin;	// binning of the split axis, for the partition
+	double			scale;
+}					t_bvh_split;
+
+// LSD radix sort of the Morton codes, shared by the threads of lbvh_sort():
+// each pass, every thread counts the digits of its slice of the keys, then
+// scatters them to where the counts of all the threads say (see below)
+typedef struct s_lbvh_sort
+{
+	t_bvh_build		*b;
+	unsigned int	*keys[2];	// codes, read from one, written to the other
+	int				*vals[2];	// primitive of each code
+	int				*hist;		// LBVH_RADIX counters per thread
+	int				threads;
+	int				shift;		// digit of the current pass
+	int				src;		// keys[src] is read by the current pass
+	t_point3		origin;		// lower corner of the centroid bounds
+	t_vec3			scale;		// centroid -> Morton grid, 0 on a flat axis
+}					t_lbvh_sort;
+
+// A thread of the sort and the slice of the keys it owns
+typedef struct s_lbvh_worker
+{
+	t_lbvh_sort		*s;
+	int				*hist;		// its own LBVH_RADIX counters
+	int				first;
+	int				end;
+}					t_lbvh_worker;
+
+// Best tree rotation found at a node: swaps the nodes a and b, b being a
+// grandchild, and shrinks the box of `parent`, b's parent, by `gain`
+typedef struct s_bvh_rotation
+{
+	double			gain;
+	int				a;
+	int				b;
+	int				parent;
+}					t_bvh_rotation;
+
+// State of a single ray walking down the BVH
+typedef struct s_bvh_trav
+{
+	t_ray			*ray;
+	t_vec3			inv_dir;	// 1 / ray direction, for the slab test
+	t_real			t_max;		// closest hit so far
+	int				stack[BVH_STACK_SIZE];	// nodes still to visit
+	t_real			dist[BVH_STACK_SIZE];	// entry distance of those nodes
+	int				sp;			// stack pointer
+}					t_bvh_trav;
+
+// State of a single ray walking down a wide BVH, in floats for SIMD
+typedef struct s_wbvh_trav
+{
+	t_ray			*ray;
+	float			org[3];		// ray origin
+	float			inv[3];		// 1 / ray direction
+	t_real			t_max;		// closest hit so far
+	float			tfar;		// t_max rounded up to a float
+	float			tnear[WBVH_MAX];	// entry distance of each child
+	int				stack[WBVH_STACK_SIZE];
+	float			dist[WBVH_STACK_SIZE];
+	int				sp;
+}					t_wbvh_trav;
+
+// A named group of objects (.rt: G <name> ... E), placed by instances.
+// Its objects are parsed once and get their own acceleration structure,
+// the bottom level, shared by all the instances of the group.
+typedef struct s_group
+{
+	char			*name;
+	t_object		*objects;	// spheres, cylinders, cones and instances
+	t_accel			*accel;		// built by accel_create() (bonus)
+	t_aabb			bounds;		// of all its objects, in group space
+	struct s_group	*next;
+}					t_group;
+
+// An instance of a group: the shape_data of an INSTANCE object.
+// (.rt: I <name> <x,y,z> <nx,ny,nz> <scale>)
+// A point p of the group lands at  pos + scale * R * p  in the scene, where
+// the rotation R turns the group's y axis into the orientation vector.
+typedef struct s_instance
+{
+	t_group			*group;
+	t_point3		pos;
+	t_vec3			cx;		// columns of R: the group's x, y and z axes
+	t_vec3			cy;		// in the scene
+	t_vec3			cz;
+	t_real			scale;
+}					t_instance;
+
 // The main scene structure
 typedef struct s_scene
 {
 	int				width;
 	int				height;
 	t_color			ambient_light;	// Ambient light color (0-255 range)
-	double			ambient_ratio;	// Ambient light ratio (0.0 - 1.0)
+	t_real			ambient_ratio;	// Ambient light ratio (0.0 - 1.0)
 	int				has_ambient;	// Flag to ensure only one ambient light
 	t_camera		camera;
 	int				has_camera;		// Flag to ensure only one camera
 	t_light			*lights;		// Linked list of lights
 	t_object		*objects;		// Linked list of objects
+	t_accel			*accel;			// built after parsing (bonus)
+	t_group			*groups;		// Linked list of groups (bonus)
+	t_group			*cur_group;		// group being parsed, until its `E`
+	t_light_soa		light_soa;		// the lights, compiled (bonus)
+	void			*cache;			// mapping of the cache file it was
+	long			cache_size;		// loaded from (bonus), NULL if parsed
+	int				packet;			// N: camera rays in N x N packets (bonus)
+	int				threads;		// rendering threads (bonus)
+	struct s_render_pool	*pool;	// the threads rendering (bonus), or NULL
 }					t_scene;
 
 // Record of a ray-object intersection
@@ -164,10 +694,10 @@ typedef struct s_hit_record
 	t_point3		p;		// Point of intersection
 	t_vec3			normal;	// Surface normal at the intersection
 	t_color			color;	// Color of the object hit
-	double			speci;	// specular intensity [0-1] range @bonus prop
-	double			shine;	// specular blur, 1 blurred, 100 sharp,
-	double			reflect;	// reflectivity, 0: nope, 1: perfect mirror
-	double			t;		// 'time' or distance along the ray
+	t_real			speci;	// specular intensity [0-1] range @bonus prop
+	t_real			shine;	// specular blur, 1 blurred, 100 sharp,
+	t_real			reflect;	// reflectivity, 0: nope, 1: perfect mirror
+	t_real			t;		// 'time' or distance along the ray
 	// t_object		*obj;	// The object that was hit
 	// int			front_face;	// 1 if ray hits from outside, 0 when
 								// hitting from inside. Alternatively we flip
@@ -178,12 +708,12 @@ typedef struct s_hit_record
 // This helps to be within the norminette 4-parameter / 5-variable limit
 typedef struct s_quadratic
 {
-	double			a;
-	double			b;
-	double			c;
-	double			discriminant;
-	double			t1;
-	double			t2;
+	t_real			a;
+	t_real			b;
+	t_real			c;
+	t_real			discriminant;
+	t_real			t1;
+	t_real			t2;
 }					t_quadratic;
 
 // Identify which part of a shape was hit (for cones)
@@ -199,23 +729,86 @@ typedef enum e_hit_part
 typedef struct s_hit_info
 {
 	int				hit;	// set to 1 if valid intersection has been found
-	double			hit_t;	// using hit_t to track the closest hit so far
-	double			t;		// t value of a **potential** new intersection
+	t_real			hit_t;	// using hit_t to track the closest hit so far
+	t_real			t;		// t value of a **potential** new intersection
 	t_point3		p;		// the calc.3D point of a potential intersesection
 	t_vec3			normal; // stores the calculated normal at the pot.inters.
 	t_hit_part		part;	// which surface produced hit_t (wall or cap)
 }					t_hit_info;
 
-// A struct because of the 5 variable limit at specular contrib. computation
-typedef struct s_spec_contrib
+// @bonus One block of LIGHT_LANES lights shaded at once at a point (see
+// calculate_lighting()): the point first, then the results, per light
+typedef struct s_shade
+{
+	t_real			p[3];		// the point shaded
+	t_real			n[3];		// its normal
+	t_real			v[3];		// unit direction to the camera
+	t_real			color[3];	// its color
+	t_real			speci;
+	t_real			shine;
+	t_real			dir[3][LIGHT_LANES];	// unit direction to the light
+	t_real			dist[LIGHT_LANES];		// distance to the light
+	t_real			diffuse[LIGHT_LANES];	// max(0, n . dir)
+	t_real			spec[LIGHT_LANES];		// max(0, v . reflected dir),
+											// then speci * its shine power
+	t_real			rgb[3][LIGHT_LANES];	// color the light adds
+}					t_shade;
+
+// @bonus The frustum of the camera rays of a tile: the 4 planes through the
+// eye and the sides of the tile on the viewport, their normals pointing out
+// (a point x is outside plane k when n[k] . x > o[k]), and the directions
+// of its corners
+typedef struct s_frustum
 {
-	t_vec3			light_dir;
-	t_vec3			view_dir;
-	t_vec3			reflect_dir;
-	double			spec_angle;
-	double			spec_intensity;
-	t_color			spec_contrib;
-}					t_spec_contrib;
+	t_point3		eye;
+	t_vec3			dir[4];
+	t_vec3			n[4];
+	t_real			o[4];
+}					t_frustum;
+
+// @bonus Up to 8x8 camera rays traced together through the binary BVH (see
+// packet_closest_hit()). A mask has a bit per ray. The rays are copied to
+// arrays of doubles, x, y and z apart, for the tests across rays of the
+// SIMD levels; t[i] is rec[i].t, the closest hit of ray i so far.
+// Bit k of planes is set when plane k of the accel is behind all the rays
+// (the first 64 planes only).
+typedef struct s_packet
+{
+	int				n;					// rays in the packet
+	int				simd;				// t_simd_level of the tests
+	t_ray			ray[PACKET_MAX];
+	t_vec3			inv_dir[PACKET_MAX];	// 1 / direction, per ray
+	t_hit_record	rec[PACKET_MAX];
+	unsigned long	hit;				// the rays that hit something
+	double			o[3][PACKET_MAX];	// origins
+	double			d[3][PACKET_MAX];	// directions
+	double			inv[3][PACKET_MAX];	// 1 / directions
+	double			dd[PACKET_MAX];		// |direction|²
+	double			t[PACKET_MAX];
+	t_frustum		fr;					// of the tile the rays go through
+	unsigned long	planes;				// the planes fr culled, see above
+}					t_packet;
+
+// @bonus The lighting of the camera rays of a tile that hit something (see
+// light_tile()): the shading of each point, its color so far, and the
+// shadow rays toward one light, traced as a packet; shadow ray k starts
+// from the point of camera ray from[k]
+typedef struct s_tile_shade
+{
+	t_shade			sh[PACKET_MAX];
+	t_color			color[PACKET_MAX];
+	int				from[PACKET_MAX];
+	t_packet		shadow;
+}					t_tile_shade;
+
+// @bonus A packet walking down the BVH: the nodes still to visit, and the
+// rays that reached each of them
+typedef struct s_packet_trav
+{
+	int				stack[BVH_STACK_SIZE];
+	unsigned long	mask[BVH_STACK_SIZE];
+	int				sp;
+}					t_packet_trav;
 
 // --- Window management ---
 
@@ -231,11 +824,163 @@ typedef struct s_mlx_data
 	int				endian;	// Endianness of the image data
 }					t_mlx_data;
 
+// @bonus A thread of a render: its deque, the tiles [head, end) of the
+// order still to render, packed as head << 32 | end in one word (atomic, on
+// its own cache line) so that the thread itself pops them from the front
+// and the others steal them from the back with a compare and swap; then
+// what it did (see render_stats())
+typedef struct s_render_worker
+{
+	unsigned long	range __attribute__((aligned(64)));
+	struct s_render_job	*job;
+	double			busy;		// CPU time spent on its tiles, in ms
+	int				tiles;		// tiles rendered
+	int				steals;		// times it stole tiles from another thread
+	t_prim_stats	stats;
+}					t_render_worker;
+
+// @bonus A frame being rendered by the threads (see render_start()): the
+// image cut in tiles of RENDER_TILE x RENDER_TILE pixels, numbered row
+// after row, and rendered in the order of a Hilbert curve over them; in
+// the background, it is shown as it goes (see render_progressive())
+typedef struct s_render_job
+{
+	t_render_worker	workers[RT_MAX_THREADS];
+	int				first;		// workers[first...] run on the threads
+	int				next_worker;	// the next one a thread takes (atomic)
+	int				count;		// workers, whether run by a thread or not
+	t_scene			*scene;
+	t_mlx_data		*mlx;
+	int				cols;		// tiles per row
+	int				tiles;
+	int				*order;		// the tiles along the curve, NULL: by row
+	int				done;		// tiles rendered so far (atomic)
+	int				cancel;		// set to stop the threads (atomic)
+	double			start;		// time the frame started, in ms
+	int				shown;		// tiles done at the last window refresh
+	double			refresh;	// time of the next window refresh
+	double			first_ms;	// until the first tiles were shown
+}					t_render_job;
+
+// @bonus The threads rendering the frames (see pool_create()), parked on
+// `wake` between two frames. A frame is handed out by pointing `job` at
+// it and bumping `frame`: each thread takes the next worker of the job,
+// then the last one done signals `idle`.
+typedef struct s_render_pool
+{
+	pthread_t		tids[RT_MAX_THREADS];
+	int				count;		// threads started
+	pthread_mutex_t	lock;		// guards what follows
+	pthread_cond_t	wake;
+	pthread_cond_t	idle;
+	t_render_job	*job;		// the frame being rendered, NULL if none
+	long			frame;		// frames handed out so far
+	int				busy;		// threads still on the frame
+	int				quit;		// set to end the threads
+}					t_render_pool;
+
+// @bonus How the tiles of the last frame were shared by the threads, for
+// --bench (see render_stats_report())
+typedef struct s_render_stats
+{
+	int				threads;
+	int				tiles;
+	int				steals;
+	double			ms;			// wall time of the frame
+	double			busy[RT_MAX_THREADS];
+	int				done[RT_MAX_THREADS];	// tiles rendered by each thread
+}					t_render_stats;
+
+// Command line options
+//	./miniRTbonus <scene.rt>
+//		[--accel linear|bvh|bvh4|bvh8|grid|hgrid|qbvh8|qbvh16]
+//		[--build sah|lbvh|lbvh-opt] [--bench] [--size WxH]
+//		[--animate N] [--stride K] [--no-cache] [--ppm FILE] [--diff FILE]
+//		[--packet 1|2|4|8] [--threads N]
+typedef struct s_options
+{
+	char			*scene_file;
+	t_accel_kind	accel;		// --accel, BVH by default
+	t_bvh_builder	builder;	// --build, SAH by default
+	int				bench;		// --bench: render headless, print timings
+	int				width;		// --size, 0: keep the scene's resolution
+	int				height;
+	int				threads;	// --threads N, 0: one per online CPU
+	int				animate;	// --animate N: frames of moving objects
+	int				stride;		// --stride K: one object out of K moves
+	int				no_cache;	// --no-cache: always parse and build
+	int				packet;		// --packet N: N x N camera rays at once
+	char			*ppm;		// --ppm FILE: save the --bench image
+	char			*diff;		// --diff FILE: compare it with a PPM image
+}					t_options;
+
+// --animate: the objects that move at every frame, and how far
+typedef struct s_anim
+{
+	t_object		**moved;
+	int				count;
+	double			speed;		// distance per frame
+	double			refit_ms;	// total time of the refitting frames
+	double			rebuild_ms;	// and of the rebuilding ones
+}					t_anim;
+
+// @bonus Hardware counters of a --bench render (see perf_counter_bonus.c):
+// cache references, cache misses, L1 data read misses
+typedef struct s_perf
+{
+	int				fd[PERF_COUNTERS];
+	long			count[PERF_COUNTERS];
+}					t_perf;
+
+// @bonus A shadow ray of the --bench replay: toward a light, up to it. The
+// rays of a tile toward a light share their group, and are traced together.
+typedef struct s_shadow_ray
+{
+	t_ray			ray;
+	t_real			t_max;
+	int				group;
+	int				hidden;		// the answer of accel_any_hit()
+}					t_shadow_ray;
+
+// @bonus A ray of the kernel --bench, against all the primitives of a type,
+// with the closest one the intersection routine finds (-1: none) and its
+// distance
+typedef struct s_kernel_probe
+{
+	t_ray			ray;
+	double			t;
+	int				best;
+}					t_kernel_probe;
+
+// Head of a scene cache file (see cache_save_bonus.c)
+typedef struct s_cache_head
+{
+	char			magic[8];	// CACHE_MAGIC
+	unsigned long	key;		// cache_key() of the scene file it was made of
+	long			size;		// of the whole file
+	long			scene;		// offset of the t_scene
+}					t_cache_head;
+
+// A cache file being written. It grows in memory; in the records written
+// to it, pointers are offsets from the start of the file (0 for NULL).
+typedef struct s_cache_buf
+{
+	char			*data;
+	long			size;
+	long			cap;
+	t_group			*group_list;	// the scene's groups,
+	long			groups;			// written as an array at this offset
+	int				failed;			// an allocation failed, don't save
+}					t_cache_buf;
+
 // A master struct to hold pointers to all major components of the program
 typedef struct s_program_data
 {
 	t_scene			*scene;
 	t_mlx_data		*mlx;
+	t_options		opt;
+	t_render_job	*job;		// @bonus the frame rendering in the background
+	t_perf			perf;		// @bonus the counters of --bench
 }					t_program_data;
 
 /*
@@ -283,7 +1028,17 @@ int					count_tokens(char **tokens);
 void				free_tokens(char **tokens);
 int					parse_color(char *str, t_color *color);
 int					parse_vec3(char *str, t_vec3 *vec, int need_norm);
-int					parse_double(char *str, double *val);
+int					parse_real(char *str, t_real *val);
+
+/* --- parser_group_bonus.c --- */
+int					add_object(t_scene *scene, t_object *obj);
+int					parse_group(char **tokens, t_scene *scene);
+int					parse_group_end(char **tokens, t_scene *scene);
+int					parse_instance(char **tokens, t_scene *scene);
+
+/* --- parser_free_bonus.c --- */
+void				free_objects(t_object *obj);
+void				free_groups(t_group *group);
 
 /* --- parser_utils_bonus.c --- */
 int					parse_int(char *str, int *val);
@@ -312,7 +1067,18 @@ void				setup_hooks(t_program_data *data);
 /* --- window.c --- */
 void				my_put_pixel_to_img(t_mlx_data *data, int x, int y,
 						int color);
-t_program_data		*init_program_data(char *scene_file);
+t_program_data		*init_program_data(t_options *opt);
+
+/* --- options_bonus.c --- */
+int					parse_options(int argc, char **argv, t_options *opt);
+int					option_threads(t_options *opt);
+
+/* --- options_values_bonus.c --- */
+int					parse_accel(char *str, t_accel_kind *kind);
+int					parse_builder(char *str, t_bvh_builder *builder);
+int					parse_count(char *str, int *count, char *err);
+int					parse_image_file(char *name, char *str, t_options *opt);
+int					parse_packet(char *str, int *packet);
 
 /*
 	############## Math Module ###################
@@ -321,19 +1087,21 @@ t_program_data		*init_program_data(char *scene_file);
 /* --- vec3_ops1.c --- */
 t_vec3				vec3_add(t_vec3 v1, t_vec3 v2);
 t_vec3				vec3_sub(t_vec3 v1, t_vec3 v2);
-t_vec3				vec3_mul(t_vec3 v, double t);
-t_vec3				vec3_div(t_vec3 v, double t);
-double				vec3_dot(t_vec3 v1, t_vec3 v2);
+t_vec3				vec3_mul(t_vec3 v, t_real t);
+t_vec3				vec3_div(t_vec3 v, t_real t);
+t_real				vec3_dot(t_vec3 v1, t_vec3 v2);
 
 /* --- vec3_ops2.c --- */
-double				vec3_length_squared(t_vec3 v);
-double				vec3_length(t_vec3 v);
+t_real				vec3_length_squared(t_vec3 v);
+t_real				vec3_length(t_vec3 v);
 t_vec3				vec3_normalize(t_vec3 v);
 t_vec3				vec3_cross(t_vec3 v1, t_vec3 v2);
 t_vec3				vec3_color_mul(t_vec3 v1, t_vec3 v2);
 
 /* --- vec3_ops3_bonus.c --- */
 t_vec3				vec3_reflect(t_vec3 in, t_vec3 n);
+t_real				vec3_axis(t_vec3 v, int axis);
+t_vec3				vec3_rotate(t_vec3 v, t_vec3 k, t_real cos_a, t_real sin_a);
 
 /*
 	############## Render Module ###################
@@ -343,6 +1111,10 @@ t_vec3				vec3_reflect(t_vec3 in, t_vec3 n);
 void				setup_camera(t_camera *cam, int img_width, int img_height);
 t_ray				get_ray(t_camera *cam, int x, int y);
 
+/* --- shape_prepare.c --- */
+void				shape_prepare(t_object *obj);
+void				shapes_prepare(t_object *objects);
+
 /* --- cylinder_intersect.c --- */
 void				get_wall_normal(t_cylinder *cy, t_hit_info *info);
 int					check_wall_hit(t_cylinder *cy, t_ray *ray,
@@ -355,27 +1127,458 @@ int					intersect_cylinder_caps(t_cylinder *cy, t_ray *r,
 						t_hit_info *info);
 
 /* --- cone_intersect.c --- */
-int					hit_cone(t_cone *co, t_ray *ray, double t_max,
+int					hit_cone(t_cone *co, t_ray *ray, t_real t_max,
 						t_hit_record *rec);
 
 /* --- intersections.c --- */
-int					hit_sphere(t_sphere *sp, t_ray *ray, double t_max,
+int					hit_sphere(t_sphere *sp, t_ray *ray, t_real t_max,
 						t_hit_record *rec);
-int					hit_plane(t_plane *pl, t_ray *ray, double t_max,
+int					hit_plane(t_plane *pl, t_ray *ray, t_real t_max,
 						t_hit_record *rec);
-int					hit_cylinder(t_cylinder *cy, t_ray *ray, double t_max,
+int					hit_cylinder(t_cylinder *cy, t_ray *ray, t_real t_max,
 						t_hit_record *rec);
-int					hit_object(t_object *obj, t_ray *ray, double t_max,
+int					hit_object(t_object *obj, t_ray *ray, t_real t_max,
 						t_hit_record *rec);
 
+/* --- instance_bonus.c --- */
+void				instance_set_transform(t_instance *in, t_point3 pos,
+						t_vec3 dir, t_real scale);
+t_aabb				instance_bounds(t_instance *in);
+int					hit_instance(t_instance *in, t_ray *ray, t_real t_max,
+						t_hit_record *rec);
+
+/* --- occlusion_bonus.c --- */
+int					occlude_sphere(t_sphere *sp, t_ray *ray, t_real t_max);
+int					occlude_plane(t_plane *pl, t_ray *ray, t_real t_max);
+int					occlude_disc(t_plane *disc, t_real r_sq, t_ray *ray,
+						t_real t_max);
+
+/* --- occlusion_quadric_bonus.c --- */
+int					occlude_cylinder(t_cylinder *cy, t_ray *ray,
+						t_real t_max);
+int					occlude_cone(t_cone *co, t_ray *ray, t_real t_max);
+
+/* --- light_soa_bonus.c --- */
+int					light_compile(t_scene *scene);
+void				light_soa_free(t_light_soa *l);
+void				light_block(t_light_soa *l, int first, t_shade *sh);
+
+/* --- light_kernel_bonus.c --- */
+void				light_dirs(t_light_soa *l, int first, t_shade *sh);
+void				light_mix(t_light_soa *l, int first, t_shade *sh);
+
+/* --- light_sse_bonus.c / light_nosimd_bonus.c (not x86-64) --- */
+void				light_dirs_sse(t_light_soa *l, int first, t_shade *sh,
+						int k);
+void				light_mix_sse(t_light_soa *l, int first, t_shade *sh,
+						int k);
+t_simd_level		light_simd_level(void);
+
+/* --- light_avx_bonus.c / light_nosimd_bonus.c (not x86-64) --- */
+void				light_dirs_avx(t_light_soa *l, int first, t_shade *sh);
+void				light_mix_avx(t_light_soa *l, int first, t_shade *sh);
+
+/* --- material_bonus.c --- */
+void				material_pack(t_material *m, t_object *obj);
+void				material_apply(t_material *m, t_hit_record *rec);
+
 /* --- ligthting.c --- */
 int					is_in_shadow(t_point3 hit_point, t_light *light,
 						t_scene *scene);
 t_color				calculate_lighting(t_hit_record *rec, t_scene *scene);
 
+/* --- lighting_bonus.c --- */
+t_color				clamp_color(t_color color);
+void				shade_init(t_shade *sh, t_hit_record *rec, t_scene *scene);
+
+/* --- light_tile_bonus.c --- */
+void				light_tile(t_scene *scene, t_packet *pk, t_tile_shade *ts);
+
 /* --- renderer.c --- */
 int					color_to_int(t_color color);
 // t_color				ray_color(t_ray *ray, t_scene *scene, int depth);
 void				render(t_scene *scene, t_mlx_data *mlx);
 
+/* --- renderer_bonus.c --- */
+t_color				ray_reflect(t_ray *ray, t_hit_record *rec, t_scene *scene,
+						int depth);
+t_color				ray_shade(t_ray *ray, t_hit_record *rec, t_scene *scene,
+						int depth);
+void				render_rect(t_scene *scene, t_mlx_data *mlx, int rect[4]);
+
+/* --- packet_render_bonus.c --- */
+void				render_packets(t_scene *scene, t_mlx_data *mlx,
+						int rect[4]);
+
+/* --- render_tiles_bonus.c --- */
+void				*render_worker(void *arg);
+void				render_start(t_render_job *job, t_scene *scene,
+						t_mlx_data *mlx, int background);
+void				render_finish(t_render_job *job);
+void				render_tiles(t_scene *scene, t_mlx_data *mlx);
+
+/* --- progressive_bonus.c --- */
+void				render_progressive(t_program_data *data);
+void				render_wait(t_program_data *data);
+void				render_cancel(t_program_data *data);
+
+/* --- render_pool_bonus.c --- */
+t_render_pool		*pool_create(int threads);
+int					pool_dispatch(t_render_pool *pool, t_render_job *job);
+void				pool_wait(t_render_pool *pool);
+void				pool_destroy(t_render_pool *pool);
+
+/* --- render_deque_bonus.c --- */
+int					deque_pop(t_render_worker *w);
+int					deque_steal(t_render_worker *w);
+void				deque_share(t_render_job *job);
+
+/* --- render_order_bonus.c --- */
+int					*tile_order(int cols, int rows);
+double				thread_time_ms(void);
+t_render_stats		*render_stats(void);
+void				render_stats_report(void);
+
+/*
+	############## Accel Module (bonus) ###################
+*/
+
+/* --- aabb_bonus.c --- */
+t_aabb				aabb_empty(void);
+t_aabb				aabb_union(t_aabb a, t_aabb b);
+double				aabb_area(t_aabb box);
+t_real				aabb_hit(t_aabb *box, t_point3 origin, t_vec3 inv_dir,
+						t_real t_max);
+
+/* --- object_bounds_bonus.c --- */
+t_aabb				object_bounds(t_object *obj);
+
+/* --- prim_cull_bonus.c --- */
+t_prim_stats		*prim_stats(void);
+void				prim_stats_add(t_prim_stats *from);
+void				prim_bounds_init(t_object *obj);
+int					prim_culled(t_prim_soa *s, int i, t_ray *ray,
+						t_real t_max);
+
+/* --- prim_soa_bonus.c --- */
+void				prim_soa_carve(t_prim_soa *s);
+long				prim_soa_doubles(t_prim_soa *s);
+int					prim_soa_alloc(t_prim_soa *s, int total);
+void				prim_soa_free(t_prim_soa *s);
+
+/* --- prim_pack_bonus.c --- */
+void				prim_pack(t_prim_soa *s, int i, t_object *obj);
+
+/* --- prim_unpack_bonus.c --- */
+t_sphere			soa_sphere(t_prim_soa *s, int k);
+t_plane				soa_plane(t_prim_soa *s, int k);
+t_cylinder			soa_cylinder(t_prim_soa *s, int k);
+t_cone				soa_cone(t_prim_soa *s, int k);
+
+/* --- prim_compile_bonus.c --- */
+int					prim_compile(t_accel *acc);
+void				prim_repack(t_accel *acc, t_object **moved, int count);
+
+/* --- prim_hit_bonus.c --- */
+int					prim_record(t_accel *acc, int i, t_ray *ray,
+						t_hit_record *rec);
+int					prim_hit(t_accel *acc, int i, t_ray *ray,
+						t_hit_record *rec);
+int					prim_blocks(t_accel *acc, int i, t_ray *ray, t_real t_max);
+int					prim_occludes(t_accel *acc, int i, t_ray *ray,
+						t_real t_max);
+
+/* --- prim_range_bonus.c --- */
+int					prim_hit_range(t_accel *acc, int range[2], t_ray *ray,
+						t_hit_record *rec);
+int					prim_occludes_range(t_accel *acc, int range[2],
+						t_ray *ray, t_real t_max);
+
+/* --- kernel_bonus.c --- */
+void				kernel_ray_init(t_kernel_ray *r, t_ray *ray, int any);
+int					kernel_pick(double lane[2][8], int lanes, double *t);
+int					kernel_closest(t_prim_soa *s, int run[3], t_ray *ray,
+						double *t);
+int					kernel_any(t_prim_soa *s, int run[3], t_ray *ray,
+						double t_max);
+
+/* --- kernel_scalar_bonus.c --- */
+double				sphere_root(t_sphere_soa *sp, int k, t_kernel_ray *r);
+int					kernel_bound(double *bound[4], int k, t_kernel_ray *r);
+int					kernel_scalar(t_prim_soa *s, int blk[3],
+						t_kernel_ray *r, double *t);
+
+/* --- cylinder_kernel_bonus.c --- */
+double				kernel_cap(double *cap[7], int k, t_kernel_ray *r);
+double				cylinder_root(t_cylinder_soa *cy, int k, t_kernel_ray *r);
+
+/* --- cone_kernel_bonus.c --- */
+double				cone_root(t_cone_soa *co, int k, t_kernel_ray *r);
+
+/* --- sphere_sse_bonus.c / sphere_nosimd_bonus.c (not x86-64) --- */
+int					spheres_sse(t_prim_soa *s, int blk[3],
+						t_kernel_ray *r, double *t);
+
+/* --- sphere_avx_bonus.c / sphere_nosimd_bonus.c (not x86-64) --- */
+int					spheres_avx(t_prim_soa *s, int blk[3],
+						t_kernel_ray *r, double *t);
+t_simd_level		kernel_simd_level(void);
+
+/* --- sphere_avx512_bonus.c / sphere_nosimd_bonus.c (not x86-64) --- */
+int					spheres_avx512(t_prim_soa *s, int blk[3],
+						t_kernel_ray *r, double *t);
+
+/* --- quadric_avx_bonus.c / quadric_nosimd_bonus.c (not x86-64) --- */
+int					quadrics_avx(t_prim_soa *s, int blk[3],
+						t_kernel_ray *r, double *t);
+
+/* --- quadric_avx512_bonus.c / quadric_nosimd_bonus.c (not x86-64) --- */
+int					quadrics_avx512(t_prim_soa *s, int blk[3],
+						t_kernel_ray *r, double *t);
+
+/* --- accel_bonus.c --- */
+t_accel				*accel_build(t_object *objects, t_options *opt);
+t_accel				*accel_create(t_scene *scene, t_options *opt);
+void				accel_free(t_accel *acc);
+
+/* --- accel_update_bonus.c --- */
+double				accel_sah_growth(t_accel *acc);
+int					accel_update(t_accel *acc, t_object **moved, int count,
+						int threads);
+
+/* --- accel_group_bonus.c --- */
+int					accel_build_groups(t_scene *scene, t_options *opt);
+
+/* --- accel_query_bonus.c --- */
+int					accel_closest_hit(t_accel *acc, t_ray *ray,
+						t_hit_record *rec);
+int					accel_any_hit(t_accel *acc, t_ray *ray, t_real t_max);
+int					accel_any_prims(t_accel *acc, t_ray *ray, t_real t_max);
+int					accel_hit_prims(t_accel *acc, t_ray *ray,
+						t_hit_record *rec);
+
+/* --- bvh_build_bonus.c --- */
+void				bvh_subdivide(t_bvh_build *b, t_bvh_task *t,
+						t_bvh_range r);
+int					bvh_build(t_accel *acc, int threads);
+
+/* --- lbvh_morton_bonus.c --- */
+void				*lbvh_codes(void *arg);
+int					lbvh_sort_init(t_lbvh_sort *s, t_bvh_build *b);
+
+/* --- lbvh_sort_bonus.c --- */
+int					lbvh_sort(t_bvh_build *b);
+
+/* --- lbvh_build_bonus.c --- */
+void				lbvh_emit(t_bvh_build *b, t_bvh_task *t, t_bvh_range r);
+void				lbvh_finish(t_accel *acc, t_bvh_build *b);
+
+/* --- bvh_init_bonus.c --- */
+void				bvh_free_build(t_bvh_build *b);
+int					bvh_init_build(t_bvh_build *b, t_accel *acc, int threads);
+t_aabb				bvh_range_bounds(t_bvh_build *b, int first, int count);
+
+/* --- bvh_bins_bonus.c --- */
+void				bvh_fill_bins(t_bvh_binning *bn);
+void				bvh_fill_bins_parallel(t_bvh_binning *bn);
+
+/* --- bvh_sah_bonus.c --- */
+int					bvh_bin_index(double c, double cmin, double scale);
+t_bvh_split			bvh_find_split(t_bvh_build *b, t_bvh_range r,
+						double parent_area);
+
+/* --- bvh_task_bonus.c --- */
+void				bvh_emit(t_bvh_build *b, t_bvh_task *t, t_bvh_range r);
+int					bvh_add_task(t_bvh_build *b, t_bvh_range r);
+int					bvh_run_tasks(t_bvh_build *b);
+
+/* --- bvh_refit_bonus.c --- */
+double				bvh_sah_cost(t_accel *acc);
+int					bvh_refit_init(t_accel *acc);
+void				bvh_refit(t_accel *acc, t_object **moved, int count);
+
+/* --- bvh_stack_bonus.c --- */
+void				bvh_trav_init(t_accel *acc, t_bvh_trav *tr, t_ray *ray,
+						t_real t_max);
+void				bvh_push_children(t_accel *acc, t_bvh_trav *tr,
+						t_bvh_node *node);
+
+/* --- bvh_traverse_bonus.c --- */
+int					bvh_closest_hit(t_accel *acc, t_ray *ray,
+						t_hit_record *rec);
+int					bvh_any_hit(t_accel *acc, t_ray *ray, t_real t_max);
+int					bvh_subtree_hit(t_accel *acc, int node, t_ray *ray,
+						t_hit_record *rec);
+
+/* --- packet_bonus.c --- */
+void				packet_lanes(t_packet *pk);
+void				packet_closest_hit(t_accel *acc, t_packet *pk);
+unsigned long		packet_box(t_packet *pk, t_aabb *box, unsigned long m);
+unsigned long		packet_cull(t_packet *pk, t_prim_soa *s, int p,
+						unsigned long m);
+
+/* --- packet_any_bonus.c --- */
+void				packet_any_hit(t_accel *acc, t_packet *pk);
+
+/* --- frustum_bonus.c --- */
+void				frustum_init(t_frustum *fr, t_camera *cam, int px[4]);
+int					frustum_box(t_frustum *fr, t_aabb *box);
+int					frustum_sphere(t_frustum *fr, t_prim_soa *s, int p);
+unsigned long		frustum_planes(t_frustum *fr, t_prim_soa *s, int first);
+
+/* --- packet_traverse_bonus.c --- */
+void				packet_walk(t_accel *acc, t_packet *pk);
+
+/* --- packet_avx_bonus.c / packet_nosimd_bonus.c (not x86-64) --- */
+unsigned long		packet_box_avx(t_packet *pk, t_aabb *box,
+						unsigned long m);
+unsigned long		packet_cull_avx(t_packet *pk, double *bound[4], int p,
+						unsigned long m);
+
+/* --- packet_avx512_bonus.c / packet_nosimd_bonus.c (not x86-64) --- */
+unsigned long		packet_box_avx512(t_packet *pk, t_aabb *box,
+						unsigned long m);
+unsigned long		packet_cull_avx512(t_packet *pk, double *bound[4], int p,
+						unsigned long m);
+
+/* --- wbvh_build_bonus.c --- */
+int					wbvh_build(t_accel *acc, int width);
+
+/* --- wbvh_node_bonus.c --- */
+void				wbvh_set_lane(t_wbvh_node *node, int lane, t_aabb *box);
+int					wbvh_test_node(t_accel *acc, t_wbvh_node *node,
+						t_wbvh_trav *tr);
+
+/* --- wbvh_simd_bonus.c / wbvh_nosimd_bonus.c (not x86-64) --- */
+t_simd_level		wbvh_simd_level(int width);
+int					wbvh_test_sse(t_wbvh_node *node, t_wbvh_trav *tr, int k);
+int					wbvh_test_avx(t_wbvh_node *node, t_wbvh_trav *tr);
+
+/* --- wbvh_traverse_bonus.c --- */
+int					wbvh_closest_hit(t_accel *acc, t_ray *ray,
+						t_hit_record *rec);
+int					wbvh_any_hit(t_accel *acc, t_ray *ray, t_real t_max);
+
+/* --- qbvh_node_bonus.c --- */
+int					qbvh_node_size(int bits);
+t_qbvh_node			*qbvh_node(t_accel *acc, int index);
+int					qbvh_get(t_accel *acc, t_qbvh_node *node, int k);
+void				qbvh_set(t_accel *acc, t_qbvh_node *node, int k, int v);
+t_aabb				qbvh_child_box(t_accel *acc, t_qbvh_node *node,
+						t_aabb *box, int i);
+
+/* --- qbvh_build_bonus.c --- */
+int					qbvh_build(t_accel *acc, int bits);
+
+/* --- qbvh_traverse_bonus.c --- */
+int					qbvh_hit(t_accel *acc, t_ray *ray, t_real t_max,
+						t_hit_record *rec);
+
+/* --- grid_build_bonus.c --- */
+int					grid_build(t_accel *acc, int hashed);
+
+/* --- grid_cells_bonus.c --- */
+void				grid_span(t_grid *g, t_aabb *box, int lo[3], int hi[3]);
+long				grid_cell_key(t_grid *g, int cell[3]);
+long				grid_slot(t_grid *g, long key);
+int					*grid_cell_items(t_grid *g, int cell[3], int *count);
+void				grid_free(t_grid *g);
+
+/* --- grid_block_bonus.c --- */
+long				grid_block_key(t_grid *g, int cell[3]);
+int					grid_skip_block(t_grid *g, t_grid_trav *tr);
+
+/* --- grid_fill_bonus.c --- */
+void				grid_fill(t_grid *g, t_aabb *boxes, int n);
+
+/* --- grid_traverse_bonus.c --- */
+int					grid_hit(t_accel *acc, t_ray *ray, t_real t_max,
+						t_hit_record *rec);
+
+/*
+	############## Cache Module (bonus) ###################
+*/
+
+/* --- cache_bonus.c --- */
+t_scene				*load_scene(t_options *opt);
+
+/* --- cache_key_bonus.c --- */
+unsigned long		cache_key(char *file, t_options *opt);
+
+/* --- cache_put_bonus.c --- */
+long				cache_put(t_cache_buf *cb, void *src, long size);
+long				cache_put_accel(t_cache_buf *cb, t_accel *acc,
+						long *objects);
+
+/* --- cache_save_bonus.c --- */
+int					cache_save(t_scene *scene, char *path, unsigned long key);
+
+/* --- cache_reloc_bonus.c --- */
+void				*cache_reloc(char *base, void *off);
+void				cache_reloc_accel(char *base, t_object **objects,
+						t_accel **accel);
+
+/* --- cache_grid_bonus.c --- */
+void				cache_put_grid(t_cache_buf *cb, t_grid *g, long accel);
+void				cache_reloc_grid(char *base, t_grid **grid);
+
+/* --- cache_qbvh_bonus.c --- */
+long				cache_put_qbvh(t_cache_buf *cb, t_accel *acc, long accel);
+
+/* --- cache_soa_bonus.c --- */
+long				cache_put_soa(t_cache_buf *cb, t_accel *acc, long accel);
+void				cache_reloc_soa(char *base, t_prim_soa *s);
+
+/* --- cache_load_bonus.c --- */
+t_scene				*cache_load(char *path, unsigned long key);
+
+/*
+	############## Bench Module (bonus) ###################
+*/
+
+/* --- accel_report_bonus.c --- */
+char				*accel_name(t_accel_kind kind);
+char				*accel_update_name(t_accel *acc, int rebuilds);
+void				accel_report(t_scene *scene);
+
+/* --- accel_stats_bonus.c --- */
+char				*builder_name(t_bvh_builder builder);
+
+/* --- prim_report_bonus.c --- */
+void				prim_report(void);
+void				grid_report(t_scene *scene);
+void				qbvh_report(t_scene *scene);
+
+/* --- bench_bonus.c --- */
+double				time_now_ms(void);
+unsigned int		image_checksum(t_mlx_data *mlx, int width, int height);
+void				run_bench(t_program_data *data);
+
+/* --- shadow_collect_bonus.c --- */
+int					shadow_collect(t_scene *scene, t_shadow_ray *rays);
+
+/* --- shadow_bench_bonus.c --- */
+void				shadow_bench(t_scene *scene);
+
+/* --- kernel_bench_bonus.c --- */
+void				kernel_bench(t_scene *scene);
+
+/* --- image_ppm_bonus.c --- */
+unsigned char		*image_rgb(t_mlx_data *mlx, int width, int height);
+int					ppm_write(char *path, unsigned char *rgb, int width,
+						int height);
+unsigned char		*ppm_read(char *path, int width, int height);
+
+/* --- image_diff_bonus.c --- */
+void				image_report(t_program_data *data);
+
+/* --- perf_counter_bonus.c --- */
+void				perf_init(t_perf *p);
+void				perf_start(t_perf *p);
+void				perf_stop(t_perf *p);
+void				perf_report(t_perf *p);
+
+/* --- animate_bonus.c --- */
+void				run_animation(t_program_data *data);
+
 #endif
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minirt_simd.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:33:17 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:32:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINIRT_SIMD_H
+# define MINIRT_SIMD_H
+
+// @bonus The pieces the AVX and AVX-512 kernels of the cylinders and the
+// cones share. They exist on x86-64 only (see SIMD_KERNELS): this header is
+// included by the files of those kernels alone, minirt.h by all the others.
+# include "minirt.h"
+# ifdef SIMD_KERNELS
+#  include <immintrin.h>
+
+/* --- quadric_avx_bonus.c --- */
+__attribute__((target("avx")))
+__m256d	dot_avx(__m256d u[3], __m256d v[3]);
+__attribute__((target("avx")))
+void	bound_avx(double *bound[4], int k, t_kernel_ray *r, __m256d *pass);
+__attribute__((target("avx")))
+void	cap_avx(__m256d cap[8], t_kernel_ray *r, __m256d *t);
+
+/* --- cylinder_avx_bonus.c --- */
+__attribute__((target("avx")))
+void	load_avx(double *src[3], int k, __m256d v[3]);
+__attribute__((target("avx")))
+void	cylinder_avx(t_cylinder_soa *cy, int k, t_kernel_ray *r, __m256d *t);
+
+/* --- cone_avx_bonus.c --- */
+__attribute__((target("avx")))
+void	cone_avx(t_cone_soa *co, int k, t_kernel_ray *r, __m256d *t);
+
+/* --- quadric_avx512_bonus.c --- */
+__attribute__((target("avx512f")))
+__m512d	dot_avx512(__m512d u[3], __m512d v[3]);
+__attribute__((target("avx512f")))
+void	bound_avx512(double *bound[4], int k, t_kernel_ray *r, __mmask8 *pass);
+__attribute__((target("avx512f")))
+void	cap_avx512(__m512d cap[8], t_kernel_ray *r, __m512d *t);
+
+/* --- cylinder_avx512_bonus.c --- */
+__attribute__((target("avx512f")))
+void	load_avx512(double *src[3], int k, __m512d v[3]);
+__attribute__((target("avx512f")))
+void	cylinder_avx512(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+			__m512d *t);
+
+/* --- cone_avx512_bonus.c --- */
+__attribute__((target("avx512f")))
+void	cone_avx512(t_cone_soa *co, int k, t_kernel_ray *r, __m512d *t);
+
+# endif
+#endif
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aabb_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:57:49 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* aabb_empty()
+	Returns an "inverted" box (min = +inf, max = -inf), the neutral element
+	of aabb_union(): any box merged with it gives back the box itself
+*/
+t_aabb	aabb_empty(void)
+{
+	t_aabb	box;
+
+	box.min = (t_point3){INFINITY, INFINITY, INFINITY};
+	box.max = (t_point3){-INFINITY, -INFINITY, -INFINITY};
+	return (box);
+}
+
+// smallest box containing both `a` and `b`
+t_aabb	aabb_union(t_aabb a, t_aabb b)
+{
+	t_aabb	box;
+
+	box.min.x = fmin(a.min.x, b.min.x);
+	box.min.y = fmin(a.min.y, b.min.y);
+	box.min.z = fmin(a.min.z, b.min.z);
+	box.max.x = fmax(a.max.x, b.max.x);
+	box.max.y = fmax(a.max.y, b.max.y);
+	box.max.z = fmax(a.max.z, b.max.z);
+	return (box);
+}
+
+/* aabb_area()
+	Half of the surface area of the box: xy + yz + zx
+	The surface area heuristic only compares areas with each other, so the
+	factor 2 is left out. An empty box has an area of 0.
+*/
+double	aabb_area(t_aabb box)
+{
+	t_vec3	e;
+
+	e = vec3_sub(box.max, box.min);
+	if (e.x < 0 || e.y < 0 || e.z < 0)
+		return (0.0);
+	return (e.x * e.y + e.y * e.z + e.z * e.x);
+}
+
+/* aabb_hit()
+	Ray vs box "slab test"
+	Input:
+		*box:		the box to test
+		origin:		origin of the ray
+		inv_dir:	1 / direction of the ray, computed once per ray
+		t_max:		the closest hit found so far
+	Return: the distance where the ray enters the box (0 if the origin is
+		inside it), or INFINITY if the box is missed or further than t_max
+
+	For each axis the ray crosses the two planes of the box at
+	t = (plane - origin) / direction. The ray is inside the box between the
+	largest entry and the smallest exit distance of the three axes.
+	A zero direction component gives an infinite inv_dir, the fmin/fmax
+	calls drop the NaN produced when the origin lies exactly on a plane.
+*/
+t_real	aabb_hit(t_aabb *box, t_point3 origin, t_vec3 inv_dir, t_real t_max)
+{
+	t_real	t0;
+	t_real	t1;
+	t_real	t_near;
+	t_real	t_far;
+
+	t0 = (box->min.x - origin.x) * inv_dir.x;
+	t1 = (box->max.x - origin.x) * inv_dir.x;
+	t_near = fmin(t0, t1);
+	t_far = fmax(t0, t1);
+	t0 = (box->min.y - origin.y) * inv_dir.y;
+	t1 = (box->max.y - origin.y) * inv_dir.y;
+	t_near = fmax(t_near, fmin(t0, t1));
+	t_far = fmin(t_far, fmax(t0, t1));
+	t0 = (box->min.z - origin.z) * inv_dir.z;
+	t1 = (box->max.z - origin.z) * inv_dir.z;
+	t_near = fmax(fmax(t_near, fmin(t0, t1)), 0.0);
+	t_far = fmin(t_far, fmax(t0, t1));
+	if (t_far < t_near || t_near >= t_max)
+		return (INFINITY);
+	return (t_near);
+}
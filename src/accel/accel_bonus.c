@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:58:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:52:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// counts the bounded objects and the planes of the object list
+static void	count_objects(t_accel *acc, t_object *obj)
+{
+	acc->prim_count = 0;
+	acc->plane_count = 0;
+	while (obj)
+	{
+		if (obj->type == PLANE)
+			acc->plane_count++;
+		else
+			acc->prim_count++;
+		obj = obj->next;
+	}
+}
+
+/* collect_objects()
+	Copies the object pointers of the scene's linked list into two flat
+	arrays: `planes` for the unbounded planes and `prims` for everything
+	else. The BVH build reorders `prims` so that each leaf references
+	a contiguous range of it. The bounding spheres of the cylinders and
+	cones are set up on the way (see prim_bounds_init()).
+	Return 1 on success, 0 on allocation failure
+*/
+static int	collect_objects(t_accel *acc, t_object *obj)
+{
+	int	i;
+	int	j;
+
+	count_objects(acc, obj);
+	acc->prims = malloc(sizeof(t_object *) * (acc->prim_count + 1));
+	acc->planes = malloc(sizeof(t_object *) * (acc->plane_count + 1));
+	if (!acc->prims || !acc->planes)
+		return (0);
+	i = 0;
+	j = 0;
+	while (obj)
+	{
+		if (obj->type == PLANE)
+			acc->planes[j++] = obj;
+		else
+		{
+			prim_bounds_init(obj);
+			acc->prims[i++] = obj;
+		}
+		obj = obj->next;
+	}
+	return (1);
+}
+
+/* accel_build()
+	Builds the acceleration structure over a list of objects
+	Input:
+		*objects:	the objects, the list itself is left untouched
+		*opt:		opt->accel: ACCEL_LINEAR (test every object), ACCEL_BVH
+					or ACCEL_BVH4 / ACCEL_BVH8 (binary BVH collapsed to 4 / 8
+					children per node), ACCEL_GRID / ACCEL_HGRID (uniform
+					grid, hashed grid), ACCEL_QBVH8 / ACCEL_QBVH16 (binary
+					BVH with quantized boxes),
+					opt->builder: SAH or linear BVH build,
+					opt->threads: threads of the BVH build
+	The objects are then compiled for the traversals (see prim_compile()).
+	Return: the new accel, or NULL on failure (error already printed)
+*/
+t_accel	*accel_build(t_object *objects, t_options *opt)
+{
+	t_accel	*acc;
+
+	acc = ft_calloc(1, sizeof(t_accel));
+	if (!acc)
+		return (error_msg("Accel: memory allocation failed"), NULL);
+	acc->kind = opt->accel;
+	acc->builder = opt->builder;
+	if (!collect_objects(acc, objects))
+		return (accel_free(acc), error_msg("Accel: allocation failed"), NULL);
+	if ((acc->kind == ACCEL_GRID || acc->kind == ACCEL_HGRID)
+		&& !grid_build(acc, acc->kind == ACCEL_HGRID))
+		return (accel_free(acc), error_msg("Grid: build failed"), NULL);
+	if (acc->kind != ACCEL_LINEAR && acc->kind != ACCEL_GRID
+		&& acc->kind != ACCEL_HGRID && !bvh_build(acc, option_threads(opt)))
+		return (accel_free(acc), error_msg("BVH: build failed"), NULL);
+	if ((acc->kind == ACCEL_BVH4 && !wbvh_build(acc, 4))
+		|| (acc->kind == ACCEL_BVH8 && !wbvh_build(acc, 8))
+		|| (acc->kind == ACCEL_QBVH8 && !qbvh_build(acc, 8))
+		|| (acc->kind == ACCEL_QBVH16 && !qbvh_build(acc, 16)))
+		return (accel_free(acc), error_msg("BVH: build failed"), NULL);
+	if (!prim_compile(acc))
+		return (accel_free(acc), error_msg("Accel: allocation failed"), NULL);
+	return (acc);
+}
+
+/* accel_create()
+	Builds the acceleration structures of a freshly parsed scene: first the
+	bottom level, one per group, then the top level over the scene's objects
+	and instances. build_ms covers both.
+	Return: the top level accel, or NULL on failure (error already printed)
+*/
+t_accel	*accel_create(t_scene *scene, t_options *opt)
+{
+	t_accel	*acc;
+	double	start;
+
+	start = time_now_ms();
+	if (!accel_build_groups(scene, opt))
+		return (NULL);
+	acc = accel_build(scene->objects, opt);
+	if (!acc)
+		return (NULL);
+	acc->build_ms = time_now_ms() - start;
+	return (acc);
+}
+
+// the objects themselves belong to the scene's list, only the arrays are ours
+void	accel_free(t_accel *acc)
+{
+	if (!acc)
+		return ;
+	free(acc->prims);
+	free(acc->planes);
+	free(acc->nodes);
+	free(acc->wnodes);
+	free(acc->qnodes);
+	free(acc->parents);
+	free(acc->leaf_of);
+	grid_free(acc->grid);
+	prim_soa_free(&acc->soa);
+	free(acc);
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_group_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:16:01 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:19:00 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* build_group()
+	Builds the bottom-level structure of a group and computes its bounds.
+	A group may hold instances of groups defined before it: those are built
+	first, their bounds are needed for the bounds of their instances.
+	Return 1 on success, 0 on failure (error already printed)
+*/
+static int	build_group(t_group *group, t_options *opt)
+{
+	t_object	*obj;
+
+	if (group->accel)
+		return (1);
+	group->bounds = aabb_empty();
+	obj = group->objects;
+	while (obj)
+	{
+		if (obj->type == INSTANCE
+			&& !build_group(((t_instance *)obj->shape_data)->group, opt))
+			return (0);
+		group->bounds = aabb_union(group->bounds, object_bounds(obj));
+		obj = obj->next;
+	}
+	group->accel = accel_build(group->objects, opt);
+	return (group->accel != NULL);
+}
+
+/* accel_build_groups()
+	Builds the bottom level of the scene: one acceleration structure per
+	group, shared by all its instances. However many times a group is
+	placed, its objects and its tree exist only once.
+	Return 1 on success, 0 on failure (error already printed)
+*/
+int	accel_build_groups(t_scene *scene, t_options *opt)
+{
+	t_group	*group;
+
+	group = scene->groups;
+	while (group)
+	{
+		if (!build_group(group, opt))
+			return (0);
+		group = group->next;
+	}
+	return (1);
+}
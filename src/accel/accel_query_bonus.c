@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_query_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:58:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:45:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* accel_closest_hit()
+	Finds the closest object hit by the ray
+	Input:
+		*acc:	the acceleration structure of the scene
+		*ray:	the ray to trace
+		*rec:	the hit record, set if anything is hit
+	Return 1 if something is hit, 0 otherwise
+
+	The planes are tested first: a close hit on a plane (the floor, a wall)
+	shrinks rec->t, which lets the BVH traversal skip every box behind it.
+*/
+int	accel_closest_hit(t_accel *acc, t_ray *ray, t_hit_record *rec)
+{
+	int	hit;
+
+	prim_stats()->rays++;
+	rec->t = REAL_MAX;
+	hit = prim_hit_range(acc, (int [2]){acc->prim_count, acc->soa.total},
+			ray, rec);
+	if (accel_hit_prims(acc, ray, rec))
+		hit = 1;
+	return (hit);
+}
+
+/* accel_hit_prims()
+	Closest hit among the bounded objects only, rec->t holding the closest
+	distance so far. This is also the bottom level query of the instances:
+	a group has no planes and its rays are not counted.
+	Return 1 if a closer hit was found, 0 otherwise
+*/
+int	accel_hit_prims(t_accel *acc, t_ray *ray, t_hit_record *rec)
+{
+	if (acc->kind == ACCEL_BVH)
+		return (bvh_closest_hit(acc, ray, rec));
+	if (acc->kind == ACCEL_BVH4 || acc->kind == ACCEL_BVH8)
+		return (wbvh_closest_hit(acc, ray, rec));
+	if (acc->kind == ACCEL_GRID || acc->kind == ACCEL_HGRID)
+		return (grid_hit(acc, ray, rec->t, rec));
+	if (acc->kind == ACCEL_QBVH8 || acc->kind == ACCEL_QBVH16)
+		return (qbvh_hit(acc, ray, rec->t, rec));
+	return (prim_hit_range(acc, (int [2]){0, acc->prim_count}, ray, rec));
+}
+
+/* accel_any_hit()
+	Occlusion query (shadow rays): is anything hit closer than t_max?
+	Counted, the planes tested first, as for the closest hit.
+	Return 1 as soon as any hit is found, 0 otherwise
+*/
+int	accel_any_hit(t_accel *acc, t_ray *ray, t_real t_max)
+{
+	prim_stats()->shadow_rays++;
+	if (prim_occludes_range(acc, (int [2]){acc->prim_count, acc->soa.total},
+			ray, t_max))
+		return (1);
+	return (accel_any_prims(acc, ray, t_max));
+}
+
+/* accel_any_prims()
+	Occlusion query among the bounded objects only. This is also the bottom
+	level query of the instances, uncounted, as accel_hit_prims().
+	Return 1 as soon as any hit is found, 0 otherwise
+*/
+int	accel_any_prims(t_accel *acc, t_ray *ray, t_real t_max)
+{
+	if (acc->kind == ACCEL_BVH)
+		return (bvh_any_hit(acc, ray, t_max));
+	if (acc->kind == ACCEL_BVH4 || acc->kind == ACCEL_BVH8)
+		return (wbvh_any_hit(acc, ray, t_max));
+	if (acc->kind == ACCEL_GRID || acc->kind == ACCEL_HGRID)
+		return (grid_hit(acc, ray, t_max, NULL));
+	if (acc->kind == ACCEL_QBVH8 || acc->kind == ACCEL_QBVH16)
+		return (qbvh_hit(acc, ray, t_max, NULL));
+	return (prim_occludes_range(acc, (int [2]){0, acc->prim_count}, ray,
+			t_max));
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_update_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:21:06 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:52:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* rebuild()
+	Builds the BVH again from scratch over the objects where they are now.
+	The parent / leaf links belong to the old tree: they are dropped and
+	set up again by the next refit. The build reorders acc->prims, they are
+	compiled again.
+	Return 1 on success, 0 on allocation failure
+*/
+static int	rebuild(t_accel *acc, int threads)
+{
+	free(acc->nodes);
+	free(acc->parents);
+	free(acc->leaf_of);
+	acc->nodes = NULL;
+	acc->parents = NULL;
+	acc->leaf_of = NULL;
+	acc->rebuilds++;
+	return (bvh_build(acc, threads) && prim_compile(acc));
+}
+
+/* rebuild_all()
+	A grid has nothing to refit: the cells an object overlaps change as it
+	moves, the grid is built again every frame (linear in the references).
+	Neither has the quantized BVH: the binary tree it comes from is gone,
+	both are built again.
+	Return 1 on success, 0 on allocation failure
+*/
+static int	rebuild_all(t_accel *acc, int threads)
+{
+	acc->rebuilds++;
+	if (acc->kind == ACCEL_GRID || acc->kind == ACCEL_HGRID)
+	{
+		grid_free(acc->grid);
+		acc->grid = NULL;
+		return (grid_build(acc, acc->kind == ACCEL_HGRID));
+	}
+	free(acc->qnodes);
+	acc->qnodes = NULL;
+	return (bvh_build(acc, threads) && qbvh_build(acc, acc->qbits)
+		&& prim_compile(acc));
+}
+
+// the wide nodes are collapsed from the binary ones, done again after a
+// refit or a rebuild (linear in the number of nodes)
+static int	rewiden(t_accel *acc)
+{
+	free(acc->wnodes);
+	acc->wnodes = NULL;
+	return (wbvh_build(acc, acc->width));
+}
+
+// SAH cost of the tree relative to its cost right after the last build
+double	accel_sah_growth(t_accel *acc)
+{
+	if (!acc->parents || acc->sah_built <= 0.0)
+		return (1.0);
+	return (bvh_sah_cost(acc) / acc->sah_built);
+}
+
+/* accel_update()
+	Brings the accel up to date after the objects in `moved` moved (their
+	shape data was changed in place), starting with their compiled copies.
+	The BVH is refitted, which is cheap, but keeps the topology of the last
+	build: it gets worse as the objects move away from where they were.
+	Once the SAH cost of the refitted tree grew past BVH_REBUILD_RATIO times
+	the cost right after the build, the tree is rebuilt instead.
+	A grid or a quantized BVH is always rebuilt, and so is a linear BVH:
+	its build is about as fast as a refit once many objects move.
+	Input:
+		*acc:		the scene's accel (the objects of the groups can't
+					move: the bounds of their instances are not refitted)
+		**moved:	the objects that moved, all in acc->prims
+		threads:	threads of a rebuild
+	Return 1 on success, 0 on allocation failure (error already printed)
+*/
+int	accel_update(t_accel *acc, t_object **moved, int count, int threads)
+{
+	prim_repack(acc, moved, count);
+	if (acc->kind >= ACCEL_GRID)
+	{
+		if (!rebuild_all(acc, threads))
+			return (error_msg("Accel: build failed"));
+		return (1);
+	}
+	if (acc->kind == ACCEL_LINEAR || acc->node_count == 0)
+		return (1);
+	if (acc->builder == BUILD_SAH && !acc->parents && !bvh_refit_init(acc))
+		return (error_msg("BVH: refit allocation failed"));
+	if (acc->builder == BUILD_SAH)
+		bvh_refit(acc, moved, count);
+	if (acc->builder != BUILD_SAH || accel_sah_growth(acc) > BVH_REBUILD_RATIO)
+	{
+		if (!rebuild(acc, threads))
+			return (error_msg("BVH: build failed"));
+	}
+	else
+		acc->refits++;
+	if (acc->width && !rewiden(acc))
+		return (error_msg("BVH: build failed"));
+	return (1);
+}
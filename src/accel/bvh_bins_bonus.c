@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_bins_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:05:12 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:05:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* bvh_fill_bins()
+	Drops every primitive of bn->first .. first + count into its bin along
+	the three axes: each bin counts its primitives and grows its box.
+	The bins must be empty (count 0, box aabb_empty()) on entry.
+*/
+void	bvh_fill_bins(t_bvh_binning *bn)
+{
+	t_bvh_bin	*bin;
+	t_point3	c;
+	int			p;
+	int			i;
+
+	i = bn->first - 1;
+	while (++i < bn->first + bn->count)
+	{
+		p = bn->b->idx[i];
+		c = bn->b->centroids[p];
+		bin = &bn->bins[0][bvh_bin_index(c.x, bn->cmin.x, bn->scale.x)];
+		bin->box = aabb_union(bin->box, bn->b->boxes[p]);
+		bin->count++;
+		bin = &bn->bins[1][bvh_bin_index(c.y, bn->cmin.y, bn->scale.y)];
+		bin->box = aabb_union(bin->box, bn->b->boxes[p]);
+		bin->count++;
+		bin = &bn->bins[2][bvh_bin_index(c.z, bn->cmin.z, bn->scale.z)];
+		bin->box = aabb_union(bin->box, bn->b->boxes[p]);
+		bin->count++;
+	}
+}
+
+static void	*bin_worker(void *arg)
+{
+	bvh_fill_bins(arg);
+	return (NULL);
+}
+
+// adds the bins of `part` to the ones of `bn`
+static void	merge_bins(t_bvh_binning *bn, t_bvh_binning *part)
+{
+	int	axis;
+	int	i;
+
+	axis = -1;
+	while (++axis < 3)
+	{
+		i = -1;
+		while (++i < BVH_BINS)
+		{
+			bn->bins[axis][i].box = aabb_union(bn->bins[axis][i].box,
+					part->bins[axis][i].box);
+			bn->bins[axis][i].count += part->bins[axis][i].count;
+		}
+	}
+}
+
+// bins slice `i` of `bn` into parts[i] on a new thread, or right here
+// if the thread can't be started. Return 1 if there is a thread to join
+static int	start_slice(t_bvh_binning *bn, t_bvh_binning *parts, int i,
+		pthread_t *tid)
+{
+	int	chunk;
+
+	chunk = (bn->count + bn->b->threads - 1) / bn->b->threads;
+	parts[i] = *bn;
+	parts[i].first = bn->first + i * chunk;
+	parts[i].count = max(0, min(chunk, bn->count - i * chunk));
+	if (pthread_create(tid, NULL, bin_worker, &parts[i]) == 0)
+		return (1);
+	bvh_fill_bins(&parts[i]);
+	return (0);
+}
+
+/* bvh_fill_bins_parallel()
+	Same as bvh_fill_bins(), for the huge nodes at the top of the tree:
+	each thread bins one slice of the range into its own copy of the
+	(empty) bins, the copies are then merged. Box unions and counts are
+	exact, so the bins, and the tree, don't depend on the thread count.
+*/
+void	bvh_fill_bins_parallel(t_bvh_binning *bn)
+{
+	t_bvh_binning	*parts;
+	pthread_t		tids[RT_MAX_THREADS];
+	char			started[RT_MAX_THREADS];
+	int				i;
+
+	parts = malloc(sizeof(t_bvh_binning) * bn->b->threads);
+	if (!parts)
+		return (bvh_fill_bins(bn));
+	i = -1;
+	while (++i < bn->b->threads)
+		started[i] = start_slice(bn, parts, i, &tids[i]);
+	while (i-- > 0)
+	{
+		if (started[i])
+			pthread_join(tids[i], NULL);
+		merge_bins(bn, &parts[i]);
+	}
+	free(parts);
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_build_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:58:52 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:28:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* partition()
+	Reorders the node's range in place: the primitives of the bins left of
+	the split plane first, then the others
+	Return: the number of primitives on the left
+*/
+static int	partition(t_bvh_build *b, t_bvh_range r, t_bvh_split *s)
+{
+	int	i;
+	int	j;
+	int	tmp;
+
+	i = r.first;
+	j = r.first + r.count - 1;
+	while (i <= j)
+	{
+		if (bvh_bin_index(vec3_axis(b->centroids[b->idx[i]], s->axis),
+				s->cmin, s->scale) < s->bin)
+			i++;
+		else
+		{
+			tmp = b->idx[i];
+			b->idx[i] = b->idx[j];
+			b->idx[j--] = tmp;
+		}
+	}
+	return (i - r.first);
+}
+
+/* bvh_subdivide()
+	Recursive top-down build of the node `r.node` of the task `t`
+	1. The node's box is the union of the boxes of its primitives
+	2. At the top of the tree, a node small enough is handed over to
+		a new task, built later, possibly by another thread
+	3. It stays a leaf if it holds a single primitive, or if the SAH says
+		that splitting it is not cheaper than intersecting everything
+		(unless it holds more than BVH_MAX_LEAF primitives)
+	4. Otherwise the range is partitioned around the split plane, the two
+		children are appended to the task's nodes and built recursively.
+		Very deep nodes are simply cut in two halves, which bounds the
+		depth of the rest of the subtree and keeps the traversal stack small.
+*/
+void	bvh_subdivide(t_bvh_build *b, t_bvh_task *t, t_bvh_range r)
+{
+	t_bvh_node	*node;
+	t_bvh_split	split;
+
+	node = &t->nodes[r.node];
+	node->box = bvh_range_bounds(b, r.first, r.count);
+	node->left_first = r.first;
+	node->count = r.count;
+	if (r.count <= 1 || (t->spawn && r.count <= BVH_TASK_SIZE
+			&& bvh_add_task(b, r)))
+		return ;
+	split = (t_bvh_split){-1, 0, r.count / 2, 0.0, 0.0, 0.0};
+	if (r.depth < BVH_MAX_SAH_DEPTH)
+		split = bvh_find_split(b, r, aabb_area(node->box));
+	if (split.cost >= r.count && r.count <= BVH_MAX_LEAF)
+		return ;
+	if (split.axis >= 0)
+		split.left_count = partition(b, r, &split);
+	node->left_first = t->node_count;
+	node->count = 0;
+	t->node_count += 2;
+	bvh_subdivide(b, t, (t_bvh_range){node->left_first, r.first,
+		split.left_count, r.depth + 1});
+	bvh_subdivide(b, t, (t_bvh_range){node->left_first + 1, r.first
+		+ split.left_count, r.count - split.left_count, r.depth + 1});
+}
+
+// permutes acc->prims into leaf order, so that each leaf is a contiguous range
+// (each object remembers its index, see bvh_refit())
+static int	reorder_prims(t_accel *acc, int *idx)
+{
+	t_object	**sorted;
+	int			i;
+
+	sorted = malloc(sizeof(t_object *) * (acc->prim_count + 1));
+	if (!sorted)
+		return (0);
+	i = -1;
+	while (++i < acc->prim_count)
+	{
+		sorted[i] = acc->prims[idx[i]];
+		sorted[i]->prim = i;
+	}
+	free(acc->prims);
+	acc->prims = sorted;
+	return (1);
+}
+
+/* bvh_build()
+	Builds the bounding volume hierarchy over acc->prims
+	A binary tree over n primitives has at most 2n - 1 nodes, the node array
+	is allocated once with that size. The top of the tree is built first,
+	on the calling thread, then the subtrees below it are built by up to
+	`threads` threads (see bvh_task_bonus.c).
+	With acc->builder BUILD_LBVH / BUILD_LBVH_OPT, the primitives are sorted
+	by Morton code first, and the tree is a linear BVH (lbvh_*_bonus.c).
+	Return 1 on success, 0 on allocation failure
+*/
+int	bvh_build(t_accel *acc, int threads)
+{
+	t_bvh_build	b;
+	t_bvh_task	top;
+
+	acc->node_count = 0;
+	if (acc->prim_count == 0)
+		return (1);
+	acc->nodes = malloc(sizeof(t_bvh_node) * (2 * acc->prim_count - 1));
+	if (!bvh_init_build(&b, acc, threads) || !acc->nodes)
+		return (bvh_free_build(&b), 0);
+	if (acc->builder != BUILD_SAH && !lbvh_sort(&b))
+		return (bvh_free_build(&b), 0);
+	top = (t_bvh_task){{0, 0, acc->prim_count, 0}, acc->nodes, 1,
+		acc->prim_count > BVH_TASK_SIZE};
+	bvh_emit(&b, &top, top.range);
+	acc->node_count = top.node_count;
+	if (!bvh_run_tasks(&b))
+		return (bvh_free_build(&b), 0);
+	if (b.codes)
+		lbvh_finish(acc, &b);
+	if (!reorder_prims(acc, b.idx))
+		return (bvh_free_build(&b), 0);
+	acc->build_threads = b.threads;
+	bvh_free_build(&b);
+	return (1);
+}
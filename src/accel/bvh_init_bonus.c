@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_init_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:00:33 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:28:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// frees the scratch arrays (on success as well as on a failed init)
+void	bvh_free_build(t_bvh_build *b)
+{
+	free(b->boxes);
+	free(b->centroids);
+	free(b->idx);
+	free(b->codes);
+	while (b->tasks && b->task_count-- > 0)
+		free(b->tasks[b->task_count].nodes);
+	free(b->tasks);
+}
+
+/* bvh_init_build()
+	Allocates the scratch arrays of the build and computes the bounding box
+	and the centroid of every primitive once.
+	The top of the tree has less than 2n / BVH_TASK_SIZE nodes of more than
+	BVH_TASK_SIZE primitives, each with at most 2 children made tasks.
+	Return 1 on success, 0 on allocation failure
+*/
+int	bvh_init_build(t_bvh_build *b, t_accel *acc, int threads)
+{
+	int	n;
+	int	i;
+
+	*b = (t_bvh_build){0};
+	b->acc = acc;
+	b->threads = max(1, min(threads, RT_MAX_THREADS));
+	n = acc->prim_count;
+	b->task_max = 4 * (n / BVH_TASK_SIZE) + 2;
+	b->tasks = malloc(sizeof(t_bvh_task) * b->task_max);
+	b->boxes = malloc(sizeof(t_aabb) * n);
+	b->centroids = malloc(sizeof(t_point3) * n);
+	b->idx = malloc(sizeof(int) * n);
+	if (!b->boxes || !b->centroids || !b->idx || !b->tasks)
+		return (0);
+	i = -1;
+	while (++i < n)
+	{
+		b->boxes[i] = object_bounds(acc->prims[i]);
+		b->centroids[i] = vec3_mul(vec3_add(b->boxes[i].min,
+					b->boxes[i].max), 0.5);
+		b->idx[i] = i;
+	}
+	return (1);
+}
+
+// union of the boxes of the primitives idx[first .. first + count)
+t_aabb	bvh_range_bounds(t_bvh_build *b, int first, int count)
+{
+	t_aabb	box;
+	int		i;
+
+	box = aabb_empty();
+	i = first - 1;
+	while (++i < first + count)
+		box = aabb_union(box, b->boxes[b->idx[i]]);
+	return (box);
+}
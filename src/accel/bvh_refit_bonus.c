@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_refit_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:21:06 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:21:06 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// SAH weight of a node: one box test for an inner node, its primitives
+// for a leaf (see bvh_find_split())
+static double	node_weight(t_bvh_node *node)
+{
+	if (node->count > 0)
+		return (node->count);
+	return (BVH_TRAV_COST);
+}
+
+// the SAH cost of the tree, normalized by the area of its root
+double	bvh_sah_cost(t_accel *acc)
+{
+	double	root_area;
+
+	if (acc->node_count == 0)
+		return (0.0);
+	root_area = aabb_area(acc->nodes[0].box);
+	if (root_area <= 0.0)
+		return (0.0);
+	return (acc->sah_area / root_area);
+}
+
+/* bvh_refit_init()
+	Links each node to its parent and each primitive to its leaf, and sums
+	the SAH cost of the tree. Done on the first refit after a build, while
+	the node boxes are still those of the build: sah_built is the cost the
+	refitted tree is compared with.
+	Return 1 on success, 0 on allocation failure
+*/
+int	bvh_refit_init(t_accel *acc)
+{
+	t_bvh_node	*node;
+	int			i;
+	int			k;
+
+	acc->parents = malloc(sizeof(int) * (acc->node_count + 1));
+	acc->leaf_of = malloc(sizeof(int) * (acc->prim_count + 1));
+	if (!acc->parents || !acc->leaf_of)
+		return (0);
+	acc->parents[0] = -1;
+	acc->sah_area = 0.0;
+	i = -1;
+	while (++i < acc->node_count)
+	{
+		node = &acc->nodes[i];
+		acc->sah_area += aabb_area(node->box) * node_weight(node);
+		k = -1;
+		while (++k < node->count)
+			acc->leaf_of[node->left_first + k] = i;
+		if (node->count > 0)
+			continue ;
+		acc->parents[node->left_first] = i;
+		acc->parents[node->left_first + 1] = i;
+	}
+	acc->sah_built = bvh_sah_cost(acc);
+	return (1);
+}
+
+/* refit_node()
+	Recomputes the box of a node from its primitives (leaf) or from the
+	boxes of its two children, and updates the SAH cost of the tree
+	Return 1 if the box changed, 0 if it stayed the same
+*/
+static int	refit_node(t_accel *acc, int i)
+{
+	t_bvh_node	*node;
+	t_aabb		box;
+	int			k;
+
+	node = &acc->nodes[i];
+	if (node->count == 0)
+		box = aabb_union(acc->nodes[node->left_first].box,
+				acc->nodes[node->left_first + 1].box);
+	else
+	{
+		box = aabb_empty();
+		k = -1;
+		while (++k < node->count)
+			box = aabb_union(box,
+					object_bounds(acc->prims[node->left_first + k]));
+	}
+	if (ft_memcmp(&box, &node->box, sizeof(t_aabb)) == 0)
+		return (0);
+	acc->sah_area += (aabb_area(box) - aabb_area(node->box))
+		* node_weight(node);
+	node->box = box;
+	return (1);
+}
+
+/* bvh_refit()
+	Refits the tree after the objects in `moved` moved: the box of the leaf
+	of each of them is recomputed, then those of its ancestors, up to the
+	first one that does not change. The tree keeps its topology, only its
+	boxes grow or shrink: O(depth) per moved object instead of a rebuild.
+	bvh_refit_init() must have been called since the last build.
+*/
+void	bvh_refit(t_accel *acc, t_object **moved, int count)
+{
+	int	i;
+	int	node;
+
+	i = -1;
+	while (++i < count)
+	{
+		node = acc->leaf_of[moved[i]->prim];
+		while (node >= 0 && refit_node(acc, node))
+			node = acc->parents[node];
+	}
+}
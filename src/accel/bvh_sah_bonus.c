@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sah_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:58:52 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:05:51 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* The Surface Area Heuristic (SAH)
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+The probability that a random ray hitting a box also hits a smaller box
+inside of it is the ratio of their surface areas. Splitting a node P into
+the children L and R therefore costs, on average:
+
+	cost = C_trav + (A(L) * N(L) + A(R) * N(R)) / A(P)
+
+A(x): surface area of the box, N(x): number of primitives, C_trav: cost of
+a box test relative to a primitive test (BVH_TRAV_COST). Keeping the node
+as a leaf costs N(P). Rather than sorting the primitives and trying every
+split position, the bounds of their centers are cut into BVH_BINS slices
+per axis and only the BVH_BINS - 1 planes between the slices are tried:
+one linear pass fills the bins, a sweep over the bins from the right
+stores the cost of the right children, a sweep from the left then adds the
+cost of the left children. This is a lot cheaper and barely worse.
+*/
+
+// bin of a centroid coordinate `c`, clamped to [0, BVH_BINS - 1]
+int	bvh_bin_index(double c, double cmin, double scale)
+{
+	int	i;
+
+	i = (int)((c - cmin) * scale);
+	if (i < 0)
+		return (0);
+	if (i >= BVH_BINS)
+		return (BVH_BINS - 1);
+	return (i);
+}
+
+/* init_binning()
+	Computes the bounds of the centroids of the range and empties the bins.
+	An axis along which all the centroids lie in the same plane can't be
+	split: its scale is 0, which puts everything into its first bin.
+*/
+static void	init_binning(t_bvh_build *b, t_bvh_binning *bn, t_bvh_range r)
+{
+	t_aabb	cb;
+	t_vec3	e;
+	int		i;
+
+	cb = aabb_empty();
+	i = r.first - 1;
+	while (++i < r.first + r.count)
+		cb = aabb_union(cb, (t_aabb){b->centroids[b->idx[i]],
+				b->centroids[b->idx[i]]});
+	*bn = (t_bvh_binning){.b = b, .first = r.first, .count = r.count,
+		.cmin = cb.min};
+	e = vec3_sub(cb.max, cb.min);
+	if (e.x > 1e-12)
+		bn->scale.x = BVH_BINS / e.x;
+	if (e.y > 1e-12)
+		bn->scale.y = BVH_BINS / e.y;
+	if (e.z > 1e-12)
+		bn->scale.z = BVH_BINS / e.z;
+	i = -1;
+	while (++i < 3 * BVH_BINS)
+		bn->bins[i / BVH_BINS][i % BVH_BINS].box = aabb_empty();
+}
+
+// right[i]: A(R) * N(R) of the right child made of the bins [i, BVH_BINS)
+static void	right_costs(t_bvh_binning *bn, int axis, double *right)
+{
+	t_aabb	box;
+	int		n;
+	int		i;
+
+	box = aabb_empty();
+	n = 0;
+	i = BVH_BINS;
+	while (--i > 0)
+	{
+		box = aabb_union(box, bn->bins[axis][i].box);
+		n += bn->bins[axis][i].count;
+		right[i] = aabb_area(box) * n;
+	}
+}
+
+/* sweep_axis()
+	Evaluates the BVH_BINS - 1 split planes along `axis` and keeps the best
+	one in *best (cost: A(L) * N(L) + A(R) * N(R), not normalized yet)
+*/
+static void	sweep_axis(t_bvh_binning *bn, int axis, t_bvh_split *best)
+{
+	double	right[BVH_BINS];
+	t_aabb	box;
+	double	cost;
+	int		n;
+	int		i;
+
+	right_costs(bn, axis, right);
+	box = aabb_empty();
+	n = 0;
+	i = 0;
+	while (++i < BVH_BINS)
+	{
+		box = aabb_union(box, bn->bins[axis][i - 1].box);
+		n += bn->bins[axis][i - 1].count;
+		cost = aabb_area(box) * n + right[i];
+		if (n > 0 && n < bn->count && cost < best->cost)
+			*best = (t_bvh_split){axis, i, n, cost,
+				vec3_axis(bn->cmin, axis), vec3_axis(bn->scale, axis)};
+	}
+}
+
+/* bvh_find_split()
+	Finds the cheapest split of the node's range over the 3 axes
+	Input:
+		*b:				the build data
+		r:				the node's range of primitives
+		parent_area:	surface area of the node's box
+	Return: the best split, its cost already normalized by A(P). Its axis
+		is -1 if all the centroids coincide (the range is then cut in two).
+*/
+t_bvh_split	bvh_find_split(t_bvh_build *b, t_bvh_range r, double parent_area)
+{
+	t_bvh_binning	bn;
+	t_bvh_split		best;
+	int				axis;
+
+	init_binning(b, &bn, r);
+	if (b->threads > 1 && r.count >= BVH_PAR_BIN_SIZE)
+		bvh_fill_bins_parallel(&bn);
+	else
+		bvh_fill_bins(&bn);
+	best = (t_bvh_split){-1, 0, r.count / 2, INFINITY, 0.0, 0.0};
+	axis = -1;
+	while (++axis < 3)
+		if (vec3_axis(bn.scale, axis) > 0.0)
+			sweep_axis(&bn, axis, &best);
+	if (best.axis < 0 || parent_area <= 0.0)
+		best.cost = r.count;
+	else
+		best.cost = BVH_TRAV_COST + best.cost / parent_area;
+	return (best);
+}
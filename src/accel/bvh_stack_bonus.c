@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_stack_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:59:19 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* bvh_trav_init()
+	Prepares the traversal of one ray: inverse direction for the slab tests
+	and the root node on the stack (if the ray hits the root's box at all)
+*/
+void	bvh_trav_init(t_accel *acc, t_bvh_trav *tr, t_ray *ray, t_real t_max)
+{
+	t_real	t_root;
+
+	tr->ray = ray;
+	tr->inv_dir.x = 1.0 / ray->direction.x;
+	tr->inv_dir.y = 1.0 / ray->direction.y;
+	tr->inv_dir.z = 1.0 / ray->direction.z;
+	tr->t_max = t_max;
+	tr->sp = 0;
+	if (acc->node_count == 0)
+		return ;
+	t_root = aabb_hit(&acc->nodes[0].box, ray->origin, tr->inv_dir, t_max);
+	if (t_root == INFINITY)
+		return ;
+	tr->stack[0] = 0;
+	tr->dist[0] = t_root;
+	tr->sp = 1;
+}
+
+static void	push(t_bvh_trav *tr, int node, t_real dist)
+{
+	if (dist == INFINITY || tr->sp >= BVH_STACK_SIZE)
+		return ;
+	tr->stack[tr->sp] = node;
+	tr->dist[tr->sp] = dist;
+	tr->sp++;
+}
+
+/* bvh_push_children()
+	Tests both children of an inner node against the ray and pushes the ones
+	that are hit. The closer child is pushed last so that it is visited
+	first: its hits shrink t_max and let the traversal skip the other one.
+*/
+void	bvh_push_children(t_accel *acc, t_bvh_trav *tr, t_bvh_node *node)
+{
+	t_real	t_left;
+	t_real	t_right;
+	int		left;
+
+	left = node->left_first;
+	t_left = aabb_hit(&acc->nodes[left].box, tr->ray->origin, tr->inv_dir,
+			tr->t_max);
+	t_right = aabb_hit(&acc->nodes[left + 1].box, tr->ray->origin,
+			tr->inv_dir, tr->t_max);
+	if (t_left <= t_right)
+	{
+		push(tr, left + 1, t_right);
+		push(tr, left, t_left);
+	}
+	else
+	{
+		push(tr, left, t_left);
+		push(tr, left + 1, t_right);
+	}
+}
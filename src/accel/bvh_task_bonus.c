@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_task_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:06:39 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:28:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* bvh_add_task()
+	Hands the node `r` of the top of the tree over to a task, which will
+	build its whole subtree. The tasks only depend on the scene, never on
+	the number of threads, and are merged back in the order they were
+	added: the tree is the same whatever the thread count.
+	Return 1 if the task was added, 0 if the caller has to build the node
+*/
+int	bvh_add_task(t_bvh_build *b, t_bvh_range r)
+{
+	if (b->task_count >= b->task_max)
+		return (0);
+	b->tasks[b->task_count++] = (t_bvh_task){r, NULL, 0, 0};
+	return (1);
+}
+
+// builds the node r of the task t and its subtree, with the SAH or as a
+// linear BVH once the primitives are sorted by Morton code
+void	bvh_emit(t_bvh_build *b, t_bvh_task *t, t_bvh_range r)
+{
+	if (b->codes)
+		lbvh_emit(b, t, r);
+	else
+		bvh_subdivide(b, t, r);
+}
+
+/* task_worker()
+	Thread routine: takes the next task not built yet, until there is none
+	left. The subtree of a task is built into its own node array, with its
+	root at index 0, so that the threads never share any memory they write
+	to (the ranges of b->idx the tasks reorder are disjoint too).
+*/
+static void	*task_worker(void *arg)
+{
+	t_bvh_build	*b;
+	t_bvh_task	*t;
+	int			i;
+
+	b = arg;
+	i = __atomic_fetch_add(&b->next_task, 1, __ATOMIC_RELAXED);
+	while (i < b->task_count)
+	{
+		t = &b->tasks[i];
+		t->nodes = malloc(sizeof(t_bvh_node) * (2 * t->range.count - 1));
+		if (!t->nodes)
+			__atomic_store_n(&b->failed, 1, __ATOMIC_RELAXED);
+		else
+		{
+			t->node_count = 1;
+			bvh_emit(b, t, (t_bvh_range){0, t->range.first,
+				t->range.count, t->range.depth});
+		}
+		i = __atomic_fetch_add(&b->next_task, 1, __ATOMIC_RELAXED);
+	}
+	return (NULL);
+}
+
+/* merge_task()
+	Copies the subtree of a task into acc->nodes: its root replaces the
+	placeholder node the task was created for, the other nodes are appended
+	and their child indices shifted accordingly (local node j > 0 lands at
+	base + j - 1, the root is never anybody's child).
+*/
+static void	merge_task(t_accel *acc, t_bvh_task *t)
+{
+	t_bvh_node	node;
+	int			base;
+	int			j;
+
+	base = acc->node_count;
+	j = -1;
+	while (++j < t->node_count)
+	{
+		node = t->nodes[j];
+		if (node.count == 0)
+			node.left_first += base - 1;
+		if (j == 0)
+			acc->nodes[t->range.node] = node;
+		else
+			acc->nodes[base + j - 1] = node;
+	}
+	acc->node_count += t->node_count - 1;
+}
+
+/* bvh_run_tasks()
+	Builds all the tasks on b->threads threads (the calling thread being
+	one of them), then merges their subtrees into acc->nodes.
+	A thread that can't be started just leaves more work to the others.
+	Return 1 on success, 0 on allocation failure
+*/
+int	bvh_run_tasks(t_bvh_build *b)
+{
+	pthread_t	tids[RT_MAX_THREADS];
+	int			started;
+	int			i;
+
+	started = 0;
+	while (started < b->threads - 1 && started < b->task_count - 1
+		&& pthread_create(&tids[started], NULL, task_worker, b) == 0)
+		started++;
+	task_worker(b);
+	while (started-- > 0)
+		pthread_join(tids[started], NULL);
+	if (b->failed)
+		return (0);
+	i = -1;
+	while (++i < b->task_count)
+		merge_task(b->acc, &b->tasks[i]);
+	return (1);
+}
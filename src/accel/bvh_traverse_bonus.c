@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_traverse_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:59:19 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:19:59 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// intersects the primitives of a leaf, keeps the closest hit in *rec
+// (rec->t and tr->t_max are the same distance)
+static int	hit_leaf(t_accel *acc, t_bvh_trav *tr, t_bvh_node *node,
+		t_hit_record *rec)
+{
+	if (!prim_hit_range(acc, (int [2]){node->left_first,
+			node->left_first + node->count}, tr->ray, rec))
+		return (0);
+	tr->t_max = rec->t;
+	return (1);
+}
+
+// walks the nodes on the stack of tr front to back (see bvh_closest_hit())
+static int	walk(t_accel *acc, t_bvh_trav *tr, t_hit_record *rec)
+{
+	t_bvh_node	*node;
+	int			hit;
+
+	hit = 0;
+	while (tr->sp-- > 0)
+	{
+		if (tr->dist[tr->sp] >= tr->t_max)
+			continue ;
+		node = &acc->nodes[tr->stack[tr->sp]];
+		if (node->count == 0)
+			bvh_push_children(acc, tr, node);
+		else if (hit_leaf(acc, tr, node, rec))
+			hit = 1;
+	}
+	return (hit);
+}
+
+/* bvh_closest_hit()
+	Walks the BVH front to back looking for the closest hit
+	Input:
+		*acc:	the acceleration structure
+		*ray:	the ray to trace
+		*rec:	rec->t holds the closest distance found so far (e.g. by the
+				planes), the record is overwritten by every closer hit
+	Return 1 if a closer hit was found in the tree, 0 otherwise
+
+	Nodes whose entry distance is already behind the closest hit are popped
+	and skipped without any further test.
+*/
+int	bvh_closest_hit(t_accel *acc, t_ray *ray, t_hit_record *rec)
+{
+	t_bvh_trav	tr;
+
+	bvh_trav_init(acc, &tr, ray, rec->t);
+	return (walk(acc, &tr, rec));
+}
+
+/* bvh_subtree_hit()
+	bvh_closest_hit() below `node` only, whose box the ray is known to
+	cross: a ray left alone in a packet walks on by itself from there (see
+	packet_walk())
+	Return 1 if a closer hit was found in the subtree, 0 otherwise
+*/
+int	bvh_subtree_hit(t_accel *acc, int node, t_ray *ray, t_hit_record *rec)
+{
+	t_bvh_trav	tr;
+
+	bvh_trav_init(acc, &tr, ray, rec->t);
+	tr.stack[0] = node;
+	tr.dist[0] = 0.0;
+	tr.sp = 1;
+	return (walk(acc, &tr, rec));
+}
+
+/* bvh_any_hit()
+	Occlusion version of the traversal, used by the shadow rays: there is no
+	closest hit to look for, the first primitive hit closer than t_max ends
+	the walk.
+	Return 1 if anything is hit, 0 otherwise
+*/
+int	bvh_any_hit(t_accel *acc, t_ray *ray, t_real t_max)
+{
+	t_bvh_trav	tr;
+	t_bvh_node	*node;
+
+	bvh_trav_init(acc, &tr, ray, t_max);
+	while (tr.sp-- > 0)
+	{
+		node = &acc->nodes[tr.stack[tr.sp]];
+		if (node->count == 0)
+		{
+			bvh_push_children(acc, &tr, node);
+			continue ;
+		}
+		if (prim_occludes_range(acc, (int [2]){node->left_first,
+				node->left_first + node->count}, ray, t_max))
+			return (1);
+	}
+	return (0);
+}
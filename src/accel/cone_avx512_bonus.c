@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cone_avx512_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:34:57 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:32:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+// the terms of wall() for the cones k .. k + 7, as in terms_avx()
+__attribute__((target("avx512f")))
+static void	terms_avx512(t_cone_soa *co, int k, t_kernel_ray *r,
+		__m512d q[5])
+{
+	__m512d	oc[3];
+	__m512d	ax[3];
+	__m512d	d[3];
+	__m512d	cs;
+	int		i;
+
+	load_avx512(co->axis, k, ax);
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm512_sub_pd(_mm512_set1_pd(r->o[i]),
+				_mm512_loadu_pd(co->tip[i] + k));
+		d[i] = _mm512_set1_pd(r->d[i]);
+	}
+	cs = _mm512_loadu_pd(co->cos_angle_sq + k);
+	q[0] = dot_avx512(d, ax);
+	q[1] = dot_avx512(oc, ax);
+	q[4] = _mm512_sub_pd(_mm512_mul_pd(q[0], q[0]), cs);
+	q[2] = _mm512_mul_pd(_mm512_set1_pd(2), _mm512_sub_pd(_mm512_mul_pd(q[0],
+					q[1]), _mm512_mul_pd(dot_avx512(d, oc), cs)));
+	q[3] = _mm512_sub_pd(_mm512_mul_pd(q[1], q[1]), _mm512_mul_pd(
+				dot_avx512(oc, oc), cs));
+	q[3] = _mm512_sub_pd(_mm512_mul_pd(q[2], q[2]), _mm512_mul_pd(
+				_mm512_mul_pd(_mm512_set1_pd(4), q[4]), q[3]));
+}
+
+// on_wall_avx() of the roots *t of the cones k .. k + 7
+__attribute__((target("avx512f")))
+static __m512d	on_wall_avx512(t_cone_soa *co, int k, __m512d q[5],
+		__m512d *t)
+{
+	__m512d	m;
+
+	m = _mm512_add_pd(q[1], _mm512_mul_pd(*t, q[0]));
+	return (_mm512_mask_blend_pd(_mm512_cmp_pd_mask(*t, _mm512_set1_pd(HIT_EPS),
+				_CMP_GT_OQ) & _mm512_cmp_pd_mask(m, _mm512_setzero_pd(),
+				_CMP_GE_OQ) & _mm512_cmp_pd_mask(m, _mm512_loadu_pd(
+					co->height + k), _CMP_LE_OQ), _mm512_set1_pd(INFINITY),
+			*t));
+}
+
+// wall() on 8 lanes: the closer of the two roots that are on the wall
+__attribute__((target("avx512f")))
+static __m512d	wall_avx512(t_cone_soa *co, int k, t_kernel_ray *r,
+		__m512d q[5])
+{
+	__m512d	nb;
+	__m512d	sq;
+	__m512d	t1;
+	__m512d	t2;
+
+	terms_avx512(co, k, r, q);
+	nb = _mm512_sub_pd(_mm512_setzero_pd(), q[2]);
+	sq = _mm512_sqrt_pd(q[3]);
+	t1 = _mm512_div_pd(_mm512_sub_pd(nb, sq), _mm512_mul_pd(
+				_mm512_set1_pd(2), q[4]));
+	t2 = _mm512_div_pd(_mm512_add_pd(nb, sq), _mm512_mul_pd(
+				_mm512_set1_pd(2), q[4]));
+	t1 = on_wall_avx512(co, k, q, &t1);
+	t2 = on_wall_avx512(co, k, q, &t2);
+	return (_mm512_mask_blend_pd(_mm512_cmp_pd_mask(t2, t1, _CMP_LT_OQ), t1,
+			t2));
+}
+
+// cone_avx() for the cones k .. k + 7
+__attribute__((target("avx512f")))
+void	cone_avx512(t_cone_soa *co, int k, t_kernel_ray *r, __m512d *t)
+{
+	__m512d		q[5];
+	__m512d		cap[8];
+	__m512d		w;
+	__mmask8	pass;
+
+	bound_avx512(co->bound, k, r, &pass);
+	*t = _mm512_set1_pd(INFINITY);
+	if (!pass)
+		return ;
+	w = wall_avx512(co, k, r, q);
+	load_avx512(co->base, k, cap);
+	load_avx512(co->axis, k, cap + 3);
+	cap[6] = _mm512_loadu_pd(co->cap_r_sq + k);
+	cap[7] = q[0];
+	cap_avx512(cap, r, t);
+	*t = _mm512_mask_blend_pd(pass, _mm512_set1_pd(INFINITY),
+			_mm512_min_pd(w, *t));
+}
+#endif
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cone_avx_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:34:20 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+/* terms_avx()
+	The terms of wall() for the cones k .. k + 3: q[0] = d · axis,
+	q[1] = oc · axis, q[2] = b, q[3] = the discriminant and q[4] = a
+*/
+__attribute__((target("avx")))
+static void	terms_avx(t_cone_soa *co, int k, t_kernel_ray *r, __m256d q[5])
+{
+	__m256d	oc[3];
+	__m256d	ax[3];
+	__m256d	d[3];
+	__m256d	cs;
+	int		i;
+
+	load_avx(co->axis, k, ax);
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm256_sub_pd(_mm256_set1_pd(r->o[i]),
+				_mm256_loadu_pd(co->tip[i] + k));
+		d[i] = _mm256_set1_pd(r->d[i]);
+	}
+	cs = _mm256_loadu_pd(co->cos_angle_sq + k);
+	q[0] = dot_avx(d, ax);
+	q[1] = dot_avx(oc, ax);
+	q[4] = _mm256_sub_pd(_mm256_mul_pd(q[0], q[0]), cs);
+	q[2] = _mm256_mul_pd(_mm256_set1_pd(2), _mm256_sub_pd(_mm256_mul_pd(q[0],
+					q[1]), _mm256_mul_pd(dot_avx(d, oc), cs)));
+	q[3] = _mm256_sub_pd(_mm256_mul_pd(q[1], q[1]), _mm256_mul_pd(
+				dot_avx(oc, oc), cs));
+	q[3] = _mm256_sub_pd(_mm256_mul_pd(q[2], q[2]), _mm256_mul_pd(
+				_mm256_mul_pd(_mm256_set1_pd(4), q[4]), q[3]));
+}
+
+// on_wall() of the roots *t of the cones k .. k + 3, INFINITY in the lanes
+// whose point is off the wall. A NaN root (no real root) is off the wall.
+__attribute__((target("avx")))
+static __m256d	on_wall_avx(t_cone_soa *co, int k, __m256d q[5], __m256d *t)
+{
+	__m256d	m;
+
+	m = _mm256_add_pd(q[1], _mm256_mul_pd(*t, q[0]));
+	return (_mm256_blendv_pd(_mm256_set1_pd(INFINITY), *t, _mm256_and_pd(
+				_mm256_cmp_pd(*t, _mm256_set1_pd(HIT_EPS), _CMP_GT_OQ),
+				_mm256_and_pd(_mm256_cmp_pd(m, _mm256_setzero_pd(),
+						_CMP_GE_OQ), _mm256_cmp_pd(m, _mm256_loadu_pd(
+							co->height + k), _CMP_LE_OQ)))));
+}
+
+// wall() on 4 lanes: the closer of the two roots that are on the wall
+__attribute__((target("avx")))
+static __m256d	wall_avx(t_cone_soa *co, int k, t_kernel_ray *r,
+		__m256d q[5])
+{
+	__m256d	nb;
+	__m256d	sq;
+	__m256d	t1;
+	__m256d	t2;
+
+	terms_avx(co, k, r, q);
+	nb = _mm256_sub_pd(_mm256_setzero_pd(), q[2]);
+	sq = _mm256_sqrt_pd(q[3]);
+	t1 = _mm256_div_pd(_mm256_sub_pd(nb, sq), _mm256_mul_pd(
+				_mm256_set1_pd(2), q[4]));
+	t2 = _mm256_div_pd(_mm256_add_pd(nb, sq), _mm256_mul_pd(
+				_mm256_set1_pd(2), q[4]));
+	t1 = on_wall_avx(co, k, q, &t1);
+	t2 = on_wall_avx(co, k, q, &t2);
+	return (_mm256_blendv_pd(t1, t2, _mm256_cmp_pd(t2, t1, _CMP_LT_OQ)));
+}
+
+/* cone_avx()
+	cone_root() for the cones k .. k + 3: the base cap and the wall,
+	sharing d · axis. If the ray misses the 4 bounding spheres (the usual
+	case), nothing else is computed.
+	*t is set to the distances, INFINITY in the lanes that miss
+*/
+__attribute__((target("avx")))
+void	cone_avx(t_cone_soa *co, int k, t_kernel_ray *r, __m256d *t)
+{
+	__m256d	q[5];
+	__m256d	cap[8];
+	__m256d	w;
+	__m256d	pass;
+
+	bound_avx(co->bound, k, r, &pass);
+	*t = _mm256_set1_pd(INFINITY);
+	if (!_mm256_movemask_pd(pass))
+		return ;
+	w = wall_avx(co, k, r, q);
+	load_avx(co->base, k, cap);
+	load_avx(co->axis, k, cap + 3);
+	cap[6] = _mm256_loadu_pd(co->cap_r_sq + k);
+	cap[7] = q[0];
+	cap_avx(cap, r, t);
+	*t = _mm256_blendv_pd(_mm256_set1_pd(INFINITY), _mm256_min_pd(w, *t),
+			pass);
+}
+#endif
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cone_kernel_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:31:24 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// is_hit_in_bounds() of a root t of the wall at entry k, m being the
+// projection of the point at t on the axis: oc · axis + t * (d · axis)
+static double	on_wall(t_cone_soa *co, int k, double dot[2], double t)
+{
+	double	m;
+
+	if (!(t > HIT_EPS))
+		return (INFINITY);
+	m = dot[1] + t * dot[0];
+	if (m >= 0 && m <= co->height[k])
+		return (t);
+	return (INFINITY);
+}
+
+/* wall()
+	intersect_cone_wall() at entry k, with the same operations in the same
+	order: the closer of the two roots that are on the wall.
+	Return the distance, INFINITY if the ray misses the wall
+*/
+static double	wall(t_cone_soa *co, int k, t_kernel_ray *r)
+{
+	double	oc[3];
+	double	dot[3];
+	double	q[3];
+	double	t[2];
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		oc[i] = r->o[i] - co->tip[i][k];
+	dot[0] = r->d[0] * co->axis[0][k] + r->d[1] * co->axis[1][k]
+		+ r->d[2] * co->axis[2][k];
+	dot[1] = oc[0] * co->axis[0][k] + oc[1] * co->axis[1][k]
+		+ oc[2] * co->axis[2][k];
+	dot[2] = r->d[0] * oc[0] + r->d[1] * oc[1] + r->d[2] * oc[2];
+	q[0] = dot[0] * dot[0] - co->cos_angle_sq[k];
+	q[1] = 2 * (dot[0] * dot[1] - dot[2] * co->cos_angle_sq[k]);
+	q[2] = q[1] * q[1] - 4 * q[0] * (dot[1] * dot[1] - (oc[0] * oc[0]
+				+ oc[1] * oc[1] + oc[2] * oc[2]) * co->cos_angle_sq[k]);
+	if (q[2] < 0)
+		return (INFINITY);
+	t[0] = on_wall(co, k, dot, (-q[1] - sqrt(q[2])) / (2 * q[0]));
+	t[1] = on_wall(co, k, dot, (-q[1] + sqrt(q[2])) / (2 * q[0]));
+	if (t[1] < t[0])
+		return (t[1]);
+	return (t[0]);
+}
+
+/* cone_root()
+	The distance hit_cone() finds on the cone at entry k, before comparing
+	it with t_max: the closest of the base cap and of the wall. The SIMD
+	kernels compute the same, lane by lane, in the same order, so that they
+	find exactly the same distances.
+	Return the distance, INFINITY if the ray misses the cone
+*/
+double	cone_root(t_cone_soa *co, int k, t_kernel_ray *r)
+{
+	double	*cap[7];
+	double	t;
+	double	w;
+
+	cap[0] = co->base[0];
+	cap[1] = co->base[1];
+	cap[2] = co->base[2];
+	cap[3] = co->axis[0];
+	cap[4] = co->axis[1];
+	cap[5] = co->axis[2];
+	cap[6] = co->cap_r_sq;
+	t = kernel_cap(cap, k, r);
+	w = wall(co, k, r);
+	if (w < t)
+		t = w;
+	return (t);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cylinder_avx512_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:34:56 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:32:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+// the terms of wall() for the cylinders k .. k + 7, as in terms_avx()
+__attribute__((target("avx512f")))
+static void	terms_avx512(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+		__m512d q[4])
+{
+	__m512d	oc[3];
+	__m512d	ax[3];
+	__m512d	d[3];
+	__m512d	oca;
+	int		i;
+
+	load_avx512(cy->axis, k, ax);
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm512_sub_pd(_mm512_set1_pd(r->o[i]),
+				_mm512_loadu_pd(cy->center[i] + k));
+		d[i] = _mm512_set1_pd(r->d[i]);
+	}
+	q[0] = dot_avx512(d, ax);
+	oca = dot_avx512(oc, ax);
+	q[3] = _mm512_sub_pd(_mm512_set1_pd(r->dd), _mm512_mul_pd(q[0], q[0]));
+	q[1] = _mm512_mul_pd(_mm512_set1_pd(2), _mm512_sub_pd(dot_avx512(d, oc),
+				_mm512_mul_pd(q[0], oca)));
+	q[2] = _mm512_sub_pd(_mm512_sub_pd(dot_avx512(oc, oc), _mm512_mul_pd(oca,
+					oca)), _mm512_loadu_pd(cy->radius_sq + k));
+	q[2] = _mm512_sub_pd(_mm512_mul_pd(q[1], q[1]), _mm512_mul_pd(
+				_mm512_mul_pd(_mm512_set1_pd(4), q[3]), q[2]));
+}
+
+// in_height() of the distances *t on the cylinders k .. k + 7
+__attribute__((target("avx512f")))
+static __mmask8	height_avx512(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+		__m512d *t)
+{
+	__m512d	q[3];
+	__m512d	ax[3];
+	int		i;
+
+	load_avx512(cy->axis, k, ax);
+	i = -1;
+	while (++i < 3)
+		q[i] = _mm512_sub_pd(_mm512_add_pd(_mm512_set1_pd(r->o[i]),
+					_mm512_mul_pd(_mm512_set1_pd(r->d[i]), *t)),
+				_mm512_loadu_pd(cy->center[i] + k));
+	q[0] = dot_avx512(q, ax);
+	return (_mm512_cmp_pd_mask(*t, _mm512_set1_pd(HIT_EPS), _CMP_GT_OQ)
+		& _mm512_cmp_pd_mask(q[0], _mm512_setzero_pd(), _CMP_GE_OQ)
+		& _mm512_cmp_pd_mask(q[0], _mm512_loadu_pd(cy->height + k),
+			_CMP_LE_OQ));
+}
+
+// wall() on 8 lanes: the near root if it is on the wall, else the far one
+__attribute__((target("avx512f")))
+static __m512d	wall_avx512(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+		__m512d q[4])
+{
+	__m512d	nb;
+	__m512d	sq;
+	__m512d	t1;
+	__m512d	t2;
+
+	terms_avx512(cy, k, r, q);
+	nb = _mm512_sub_pd(_mm512_setzero_pd(), q[1]);
+	sq = _mm512_sqrt_pd(q[2]);
+	t1 = _mm512_div_pd(_mm512_sub_pd(nb, sq), _mm512_mul_pd(
+				_mm512_set1_pd(2), q[3]));
+	t2 = _mm512_div_pd(_mm512_add_pd(nb, sq), _mm512_mul_pd(
+				_mm512_set1_pd(2), q[3]));
+	t2 = _mm512_mask_blend_pd(height_avx512(cy, k, r, &t2),
+			_mm512_set1_pd(INFINITY), t2);
+	return (_mm512_mask_blend_pd(height_avx512(cy, k, r, &t1), t2, t1));
+}
+
+// load_avx() of the entries k .. k + 7
+__attribute__((target("avx512f")))
+void	load_avx512(double *src[3], int k, __m512d v[3])
+{
+	v[0] = _mm512_loadu_pd(src[0] + k);
+	v[1] = _mm512_loadu_pd(src[1] + k);
+	v[2] = _mm512_loadu_pd(src[2] + k);
+}
+
+// cylinder_avx() for the cylinders k .. k + 7
+__attribute__((target("avx512f")))
+void	cylinder_avx512(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+			__m512d *t)
+{
+	__m512d		q[4];
+	__m512d		cap[8];
+	__m512d		c;
+	__mmask8	pass;
+
+	bound_avx512(cy->bound, k, r, &pass);
+	*t = _mm512_set1_pd(INFINITY);
+	if (!pass)
+		return ;
+	*t = wall_avx512(cy, k, r, q);
+	load_avx512(cy->center, k, cap);
+	load_avx512(cy->axis, k, cap + 3);
+	cap[6] = _mm512_loadu_pd(cy->radius_sq + k);
+	cap[7] = q[0];
+	cap_avx512(cap, r, &c);
+	*t = _mm512_min_pd(c, *t);
+	load_avx512(cy->top, k, cap);
+	cap_avx512(cap, r, &c);
+	*t = _mm512_mask_blend_pd(pass, _mm512_set1_pd(INFINITY),
+			_mm512_min_pd(c, *t));
+}
+#endif
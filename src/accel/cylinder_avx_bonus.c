@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cylinder_avx_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:33:48 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+/* terms_avx()
+	The terms of wall() for the cylinders k .. k + 3: q[0] = d · axis,
+	q[1] = b, q[2] = the discriminant and q[3] = a
+*/
+__attribute__((target("avx")))
+static void	terms_avx(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+		__m256d q[4])
+{
+	__m256d	oc[3];
+	__m256d	ax[3];
+	__m256d	d[3];
+	__m256d	oca;
+	int		i;
+
+	load_avx(cy->axis, k, ax);
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm256_sub_pd(_mm256_set1_pd(r->o[i]),
+				_mm256_loadu_pd(cy->center[i] + k));
+		d[i] = _mm256_set1_pd(r->d[i]);
+	}
+	q[0] = dot_avx(d, ax);
+	oca = dot_avx(oc, ax);
+	q[3] = _mm256_sub_pd(_mm256_set1_pd(r->dd), _mm256_mul_pd(q[0], q[0]));
+	q[1] = _mm256_mul_pd(_mm256_set1_pd(2), _mm256_sub_pd(dot_avx(d, oc),
+				_mm256_mul_pd(q[0], oca)));
+	q[2] = _mm256_sub_pd(_mm256_sub_pd(dot_avx(oc, oc), _mm256_mul_pd(oca,
+					oca)), _mm256_loadu_pd(cy->radius_sq + k));
+	q[2] = _mm256_sub_pd(_mm256_mul_pd(q[1], q[1]), _mm256_mul_pd(
+				_mm256_mul_pd(_mm256_set1_pd(4), q[3]), q[2]));
+}
+
+// in_height() of the distances *t on the cylinders k .. k + 3: the mask
+// of the lanes whose point is on the wall
+__attribute__((target("avx")))
+static __m256d	height_avx(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+		__m256d *t)
+{
+	__m256d	q[3];
+	__m256d	ax[3];
+	int		i;
+
+	load_avx(cy->axis, k, ax);
+	i = -1;
+	while (++i < 3)
+		q[i] = _mm256_sub_pd(_mm256_add_pd(_mm256_set1_pd(r->o[i]),
+					_mm256_mul_pd(_mm256_set1_pd(r->d[i]), *t)),
+				_mm256_loadu_pd(cy->center[i] + k));
+	q[0] = dot_avx(q, ax);
+	return (_mm256_and_pd(_mm256_cmp_pd(*t, _mm256_set1_pd(HIT_EPS),
+				_CMP_GT_OQ), _mm256_and_pd(_mm256_cmp_pd(q[0],
+					_mm256_setzero_pd(), _CMP_GE_OQ), _mm256_cmp_pd(q[0],
+					_mm256_loadu_pd(cy->height + k), _CMP_LE_OQ))));
+}
+
+// wall() on 4 lanes: the near root if it is on the wall, else the far one
+__attribute__((target("avx")))
+static __m256d	wall_avx(t_cylinder_soa *cy, int k, t_kernel_ray *r,
+		__m256d q[4])
+{
+	__m256d	nb;
+	__m256d	sq;
+	__m256d	t1;
+	__m256d	t2;
+
+	terms_avx(cy, k, r, q);
+	nb = _mm256_sub_pd(_mm256_setzero_pd(), q[1]);
+	sq = _mm256_sqrt_pd(q[2]);
+	t1 = _mm256_div_pd(_mm256_sub_pd(nb, sq), _mm256_mul_pd(
+				_mm256_set1_pd(2), q[3]));
+	t2 = _mm256_div_pd(_mm256_add_pd(nb, sq), _mm256_mul_pd(
+				_mm256_set1_pd(2), q[3]));
+	t2 = _mm256_blendv_pd(_mm256_set1_pd(INFINITY), t2,
+			height_avx(cy, k, r, &t2));
+	return (_mm256_blendv_pd(t2, t1, height_avx(cy, k, r, &t1)));
+}
+
+// the entries k .. k + 3 of the arrays x, y and z of a vector, in v[]
+__attribute__((target("avx")))
+void	load_avx(double *src[3], int k, __m256d v[3])
+{
+	v[0] = _mm256_loadu_pd(src[0] + k);
+	v[1] = _mm256_loadu_pd(src[1] + k);
+	v[2] = _mm256_loadu_pd(src[2] + k);
+}
+
+/* cylinder_avx()
+	cylinder_root() for the cylinders k .. k + 3: the wall, then both caps,
+	sharing d · axis. If the ray misses the 4 bounding spheres (the usual
+	case), nothing else is computed.
+	*t is set to the distances, INFINITY in the lanes that miss
+*/
+__attribute__((target("avx")))
+void	cylinder_avx(t_cylinder_soa *cy, int k, t_kernel_ray *r, __m256d *t)
+{
+	__m256d	q[4];
+	__m256d	cap[8];
+	__m256d	c;
+	__m256d	pass;
+
+	bound_avx(cy->bound, k, r, &pass);
+	*t = _mm256_set1_pd(INFINITY);
+	if (!_mm256_movemask_pd(pass))
+		return ;
+	*t = wall_avx(cy, k, r, q);
+	load_avx(cy->center, k, cap);
+	load_avx(cy->axis, k, cap + 3);
+	cap[6] = _mm256_loadu_pd(cy->radius_sq + k);
+	cap[7] = q[0];
+	cap_avx(cap, r, &c);
+	*t = _mm256_min_pd(c, *t);
+	load_avx(cy->top, k, cap);
+	cap_avx(cap, r, &c);
+	*t = _mm256_blendv_pd(_mm256_set1_pd(INFINITY), _mm256_min_pd(c, *t),
+			pass);
+}
+#endif
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cylinder_kernel_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:31:24 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* kernel_cap()
+	hit_plane() on a cap disc, then the test of its radius: the distance
+	check_single_cap() or intersect_cone_cap() find, before comparing it
+	with t_max. cap[] holds the arrays of the center of the disc (x, y, z),
+	of the axis (x, y, z) and of its radius². The bottom cap of a cylinder
+	faces -axis: both the numerator and the denominator of t change sign,
+	t is exactly the same.
+	Return the distance, INFINITY if the ray misses the disc
+*/
+double	kernel_cap(double *cap[7], int k, t_kernel_ray *r)
+{
+	double	q[3];
+	double	den;
+	double	t;
+	int		i;
+
+	den = r->d[0] * cap[3][k] + r->d[1] * cap[4][k] + r->d[2] * cap[5][k];
+	if (fabs(den) < PARALLEL_EPS)
+		return (INFINITY);
+	i = -1;
+	while (++i < 3)
+		q[i] = cap[i][k] - r->o[i];
+	t = (q[0] * cap[3][k] + q[1] * cap[4][k] + q[2] * cap[5][k]) / den;
+	if (t <= HIT_EPS)
+		return (INFINITY);
+	i = -1;
+	while (++i < 3)
+		q[i] = r->o[i] + r->d[i] * t - cap[i][k];
+	if (q[0] * q[0] + q[1] * q[1] + q[2] * q[2] <= cap[6][k])
+		return (t);
+	return (INFINITY);
+}
+
+// check_wall_hit(): is the point at t on the wall between the two caps?
+static int	in_height(t_cylinder_soa *cy, int k, t_kernel_ray *r, double t)
+{
+	double	q[3];
+	double	m;
+	int		i;
+
+	if (!(t > HIT_EPS))
+		return (0);
+	i = -1;
+	while (++i < 3)
+		q[i] = r->o[i] + r->d[i] * t - cy->center[i][k];
+	m = q[0] * cy->axis[0][k] + q[1] * cy->axis[1][k] + q[2] * cy->axis[2][k];
+	return (m >= 0 && m <= cy->height[k]);
+}
+
+/* wall()
+	intersect_cylinder_wall() at entry k, with the same operations in the
+	same order: the near root if it is on the wall, else the far one. A
+	negative discriminant gives NaN roots, which in_height() rejects.
+	Return the distance, INFINITY if the ray misses the wall
+*/
+static double	wall(t_cylinder_soa *cy, int k, t_kernel_ray *r)
+{
+	double	oc[3];
+	double	dot[3];
+	double	q[3];
+	double	t;
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		oc[i] = r->o[i] - cy->center[i][k];
+	dot[0] = r->d[0] * cy->axis[0][k] + r->d[1] * cy->axis[1][k]
+		+ r->d[2] * cy->axis[2][k];
+	dot[1] = oc[0] * cy->axis[0][k] + oc[1] * cy->axis[1][k]
+		+ oc[2] * cy->axis[2][k];
+	dot[2] = r->d[0] * oc[0] + r->d[1] * oc[1] + r->d[2] * oc[2];
+	q[0] = r->dd - dot[0] * dot[0];
+	q[1] = 2 * (dot[2] - dot[0] * dot[1]);
+	q[2] = q[1] * q[1] - 4 * q[0] * (oc[0] * oc[0] + oc[1] * oc[1] + oc[2]
+			* oc[2] - dot[1] * dot[1] - cy->radius_sq[k]);
+	t = (-q[1] - sqrt(q[2])) / (2 * q[0]);
+	if (!in_height(cy, k, r, t))
+		t = (-q[1] + sqrt(q[2])) / (2 * q[0]);
+	if (!in_height(cy, k, r, t))
+		return (INFINITY);
+	return (t);
+}
+
+/* cylinder_root()
+	The distance hit_cylinder() finds on the cylinder at entry k, before
+	comparing it with t_max: the closest of the wall and of both caps. The
+	SIMD kernels compute the same, lane by lane, in the same order, so that
+	they find exactly the same distances.
+	Return the distance, INFINITY if the ray misses the cylinder
+*/
+double	cylinder_root(t_cylinder_soa *cy, int k, t_kernel_ray *r)
+{
+	double	*cap[7];
+	double	t;
+	double	c;
+
+	t = wall(cy, k, r);
+	cap[0] = cy->center[0];
+	cap[1] = cy->center[1];
+	cap[2] = cy->center[2];
+	cap[3] = cy->axis[0];
+	cap[4] = cy->axis[1];
+	cap[5] = cy->axis[2];
+	cap[6] = cy->radius_sq;
+	c = kernel_cap(cap, k, r);
+	if (c < t)
+		t = c;
+	cap[0] = cy->top[0];
+	cap[1] = cy->top[1];
+	cap[2] = cy->top[2];
+	c = kernel_cap(cap, k, r);
+	if (c < t)
+		t = c;
+	return (t);
+}
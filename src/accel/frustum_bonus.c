@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frustum_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:22:08 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:26:41 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the unit direction from the eye to the top left corner of pixel (x, y)
+// on the viewport
+static t_vec3	corner(t_camera *cam, int x, int y)
+{
+	t_point3	p;
+
+	p = vec3_add(cam->pixel00_loc, vec3_add(vec3_mul(cam->pixel_delta_u,
+					x - 0.5), vec3_mul(cam->pixel_delta_v, y - 0.5)));
+	return (vec3_normalize(vec3_sub(p, cam->origin)));
+}
+
+/* frustum_init()
+	The frustum of the camera rays through the pixels px[0] <= x < px[2],
+	px[1] <= y < px[3]. Its sides go through the corners of the pixels,
+	half a pixel away from the centers the rays go through, a margin no
+	rounding of the rays crosses.
+*/
+void	frustum_init(t_frustum *fr, t_camera *cam, int px[4])
+{
+	t_vec3	mid;
+	int		k;
+
+	fr->eye = cam->origin;
+	mid = (t_vec3){0, 0, 0};
+	k = -1;
+	while (++k < 4)
+	{
+		fr->dir[k] = corner(cam, px[2 * (k == 1 || k == 2)],
+				px[1 + 2 * (k > 1)]);
+		mid = vec3_add(mid, fr->dir[k]);
+	}
+	k = -1;
+	while (++k < 4)
+	{
+		fr->n[k] = vec3_normalize(vec3_cross(fr->dir[k],
+					fr->dir[(k + 1) % 4]));
+		if (vec3_dot(fr->n[k], mid) > 0)
+			fr->n[k] = vec3_mul(fr->n[k], -1);
+		fr->o[k] = vec3_dot(fr->n[k], fr->eye);
+	}
+}
+
+/* frustum_box()
+	Whether the box lies outside the frustum: all of it on the outer side
+	of one of its planes, its corner nearest to that side included.
+	The test is conservative, a box outside across an edge passes.
+	Return 1 if no ray of the tile can cross the box
+*/
+int	frustum_box(t_frustum *fr, t_aabb *box)
+{
+	t_point3	p;
+	int			k;
+
+	k = -1;
+	while (++k < 4)
+	{
+		p = box->max;
+		if (fr->n[k].x > 0)
+			p.x = box->min.x;
+		if (fr->n[k].y > 0)
+			p.y = box->min.y;
+		if (fr->n[k].z > 0)
+			p.z = box->min.z;
+		if (fr->n[k].x * p.x + fr->n[k].y * p.y + fr->n[k].z * p.z
+			> fr->o[k])
+			return (1);
+	}
+	return (0);
+}
+
+/* frustum_sphere()
+	frustum_box() for the bounding sphere of primitive p (not an instance,
+	whose sphere is not kept, see prim_pack())
+	Return 1 if no ray of the tile can hit the primitive
+*/
+int	frustum_sphere(t_frustum *fr, t_prim_soa *s, int p)
+{
+	t_real	d;
+	int		k;
+
+	k = -1;
+	while (++k < 4)
+	{
+		d = fr->n[k].x * s->bound[0][p] + fr->n[k].y * s->bound[1][p]
+			+ fr->n[k].z * s->bound[2][p] - fr->o[k];
+		if (d > 0 && d * d > s->bound[3][p])
+			return (1);
+	}
+	return (0);
+}
+
+/* frustum_planes()
+	The planes of the accel (primitives first, first + 1...) that no ray
+	of the tile hits: those the 4 corner directions all go away from, or
+	run along. The rays of the tile are in between, they go away from the
+	plane too, or so nearly along it that hit_plane() finds no hit.
+	Return the mask of those planes, among the first 64
+*/
+unsigned long	frustum_planes(t_frustum *fr, t_prim_soa *s, int first)
+{
+	unsigned long	culled;
+	t_plane			pl;
+	t_real			side;
+	int				k;
+	int				c;
+
+	culled = 0;
+	k = -1;
+	while (++k < 64 && first + k < s->total)
+	{
+		pl = soa_plane(s, s->slot[first + k]);
+		side = vec3_dot(vec3_sub(pl.point, fr->eye), pl.normal);
+		c = 0;
+		while (c < 4 && vec3_dot(fr->dir[c], pl.normal) * side <= 0)
+			c++;
+		if (c == 4)
+			culled |= 1UL << k;
+	}
+	return (culled);
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_block_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:07:19 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// index of the block holding a cell
+long	grid_block_key(t_grid *g, int cell[3])
+{
+	return (cell[0] / GRID_BLOCK + g->bres[0] * ((long)(cell[1] / GRID_BLOCK)
+		+ (long)g->bres[1] * (cell[2] / GRID_BLOCK)));
+}
+
+/* block_exit()
+	For each axis, the number of cells left between the current cell and
+	the side of its block (or of the grid) the ray walks towards
+	Return the axis through which the ray leaves the block, *t_exit: where
+*/
+static int	block_exit(t_grid *g, t_grid_trav *tr, int left[3], t_real *t_exit)
+{
+	t_real	t;
+	int		e;
+	int		a;
+
+	e = 0;
+	*t_exit = INFINITY;
+	a = -1;
+	while (++a < 3)
+	{
+		left[a] = min(GRID_BLOCK - 1 - tr->cell[a] % GRID_BLOCK,
+				g->res[a] - 1 - tr->cell[a]);
+		if (tr->step[a] < 0)
+			left[a] = tr->cell[a] % GRID_BLOCK;
+		if (tr->t_delta[a] == INFINITY)
+			continue ;
+		t = tr->t_next[a] + left[a] * tr->t_delta[a];
+		if (t >= *t_exit)
+			continue ;
+		*t_exit = t;
+		e = a;
+	}
+	return (e);
+}
+
+/* grid_skip_block()
+	The current cell lies in an empty block: moves the walk to the first
+	cell past the block at once. On each axis, the ray crosses every cell
+	boundary closer than the exit of the block, which would take one
+	trav_step() each.
+	Return 0 if the ray leaves the grid, or if the block ends beyond
+	tr->t_max
+*/
+int	grid_skip_block(t_grid *g, t_grid_trav *tr)
+{
+	t_real	t_exit;
+	int		left[3];
+	int		e;
+	int		a;
+	int		k;
+
+	e = block_exit(g, tr, left, &t_exit);
+	if (t_exit >= tr->t_max)
+		return (0);
+	a = -1;
+	while (++a < 3)
+	{
+		k = 0;
+		if (a == e)
+			k = left[a] + 1;
+		else if (tr->t_next[a] < t_exit)
+			k = min(left[a], ceil((t_exit - tr->t_next[a])
+						/ tr->t_delta[a]));
+		tr->cell[a] += k * tr->step[a];
+		if (k > 0)
+			tr->t_next[a] += k * tr->t_delta[a];
+	}
+	return (tr->cell[e] >= 0 && tr->cell[e] < g->res[e]);
+}
@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_build_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:02:04 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:11:24 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* uniform_resolution()
+	The plain grid gets about GRID_DENSITY cells per object, as cubic as
+	possible: k = cbrt(GRID_DENSITY * n / volume) cells per unit of length
+	(a flat side of the scene is counted as a thin slab)
+*/
+static void	uniform_resolution(t_grid *g, int n)
+{
+	t_vec3	d;
+	double	thin;
+	double	k;
+	int		a;
+
+	d = vec3_sub(g->box.max, g->box.min);
+	thin = fmax(fmax(d.x, d.y), d.z) * 1e-3 + 1e-9;
+	d = (t_vec3){fmax(d.x, thin), fmax(d.y, thin), fmax(d.z, thin)};
+	k = cbrt(GRID_DENSITY * n / (d.x * d.y * d.z));
+	a = -1;
+	while (++a < 3)
+		g->res[a] = fmin(fmax(vec3_axis(d, a) * k, 1.0), GRID_MAX_RES);
+}
+
+/* set_resolution()
+	The hashed grid only stores the cells holding something, so its cells
+	can follow the size of the objects rather than their number: the cell
+	is GRID_HASH_CELL times the mean size of an object. In a sparse scene
+	(clusters of objects in a lot of empty space) the cells stay small
+	where the objects are, and the empty ones cost nothing.
+*/
+static void	set_resolution(t_grid *g, t_aabb *boxes, int n, int hashed)
+{
+	t_vec3	d;
+	double	size;
+	int		i;
+
+	if (!hashed)
+	{
+		uniform_resolution(g, n);
+		return ;
+	}
+	size = 0.0;
+	i = -1;
+	while (++i < n)
+	{
+		d = vec3_sub(boxes[i].max, boxes[i].min);
+		size += (d.x + d.y + d.z) / 3.0;
+	}
+	size = fmax(size / n * GRID_HASH_CELL, 1e-9);
+	d = vec3_sub(g->box.max, g->box.min);
+	i = -1;
+	while (++i < 3)
+		g->res[i] = fmin(fmax(ceil(vec3_axis(d, i) / size), 1.0),
+				GRID_MAX_RES);
+}
+
+/* set_cells()
+	Sets the size of the cells and counts the references (object, cell)
+	the grid will hold. A few huge objects in a fine grid can overlap
+	millions of cells: beyond GRID_MAX_REFS references the resolution is
+	halved until it fits.
+	Return the number of references
+*/
+static long	set_cells(t_grid *g, t_aabb *boxes, int n)
+{
+	long	refs;
+	int		lo[3];
+	int		hi[3];
+	int		i;
+
+	refs = -1;
+	while (refs < 0 || (refs > GRID_MAX_REFS
+			&& g->res[0] * g->res[1] * g->res[2] > 1))
+	{
+		i = -1;
+		while (refs >= 0 && ++i < 3)
+			g->res[i] = (g->res[i] + 1) / 2;
+		g->cell = vec3_sub(g->box.max, g->box.min);
+		g->cell = (t_vec3){fmax(g->cell.x / g->res[0], 1e-9), fmax(g->cell.y
+				/ g->res[1], 1e-9), fmax(g->cell.z / g->res[2], 1e-9)};
+		refs = 0;
+		i = -1;
+		while (++i < n)
+		{
+			grid_span(g, &boxes[i], lo, hi);
+			refs += (long)(hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1)
+				* (hi[2] - lo[2] + 1);
+		}
+	}
+	return (refs);
+}
+
+/* grid_alloc()
+	The plain grid has a counter per cell, the hashed one a hash table of
+	twice as many slots as references (each reference is at most a new
+	cell), its free slots have the key -1. Both get a byte per block.
+	Return 1 on success, 0 on allocation failure
+*/
+static int	grid_alloc(t_grid *g, int hashed)
+{
+	long	slots;
+
+	g->items = malloc(sizeof(int) * (g->item_count + 1));
+	g->bres[0] = (g->res[0] + GRID_BLOCK - 1) / GRID_BLOCK;
+	g->bres[1] = (g->res[1] + GRID_BLOCK - 1) / GRID_BLOCK;
+	g->bres[2] = (g->res[2] + GRID_BLOCK - 1) / GRID_BLOCK;
+	g->blocks = ft_calloc((long)g->bres[0] * g->bres[1] * g->bres[2], 1);
+	if (!hashed)
+	{
+		g->start = ft_calloc((long)g->res[0] * g->res[1] * g->res[2] + 1,
+				sizeof(int));
+		return (g->items && g->blocks && g->start);
+	}
+	slots = 1;
+	while (slots < 2 * g->item_count)
+		slots *= 2;
+	g->hash_mask = slots - 1;
+	g->slots = ft_calloc(slots, sizeof(t_grid_slot));
+	while (g->slots && slots-- > 0)
+		g->slots[slots].key = -1;
+	return (g->items && g->blocks && g->slots);
+}
+
+/* grid_build()
+	Builds the uniform grid (or the hashed one) over acc->prims
+	Return 1 on success, 0 on allocation failure
+*/
+int	grid_build(t_accel *acc, int hashed)
+{
+	t_grid	*g;
+	t_aabb	*boxes;
+	int		i;
+
+	if (acc->prim_count == 0)
+		return (1);
+	g = ft_calloc(1, sizeof(t_grid));
+	boxes = malloc(sizeof(t_aabb) * acc->prim_count);
+	acc->grid = g;
+	if (!g || !boxes)
+		return (free(boxes), 0);
+	g->box = aabb_empty();
+	i = -1;
+	while (++i < acc->prim_count)
+	{
+		boxes[i] = object_bounds(acc->prims[i]);
+		g->box = aabb_union(g->box, boxes[i]);
+	}
+	set_resolution(g, boxes, acc->prim_count, hashed);
+	g->item_count = set_cells(g, boxes, acc->prim_count);
+	if (!grid_alloc(g, hashed))
+		return (free(boxes), 0);
+	grid_fill(g, boxes, acc->prim_count);
+	return (free(boxes), 1);
+}
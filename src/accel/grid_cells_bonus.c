@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_cells_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:02:30 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:11:24 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the range of cells overlapped by a box, on each axis
+void	grid_span(t_grid *g, t_aabb *box, int lo[3], int hi[3])
+{
+	int	a;
+
+	a = -1;
+	while (++a < 3)
+	{
+		lo[a] = (vec3_axis(box->min, a) - vec3_axis(g->box.min, a))
+			/ vec3_axis(g->cell, a);
+		hi[a] = (vec3_axis(box->max, a) - vec3_axis(g->box.min, a))
+			/ vec3_axis(g->cell, a);
+		lo[a] = max(0, min(lo[a], g->res[a] - 1));
+		hi[a] = max(0, min(hi[a], g->res[a] - 1));
+	}
+}
+
+// index of a cell in the plain grid, key of the cell in the hashed one
+long	grid_cell_key(t_grid *g, int cell[3])
+{
+	return (cell[0] + g->res[0] * ((long)cell[1] + (long)g->res[1]
+			* cell[2]));
+}
+
+/* grid_slot()
+	Open addressing with linear probing: the slot of the hashed grid
+	holding the cell `key`, or the free slot where it would go.
+	The key is scrambled first (Fibonacci hashing): the keys of neighbour
+	cells are consecutive, they would fill runs of consecutive slots.
+*/
+long	grid_slot(t_grid *g, long key)
+{
+	long	slot;
+
+	slot = (((unsigned long)key * 11400714819323198485UL) >> 24)
+		& g->hash_mask;
+	while (g->slots[slot].key != key && g->slots[slot].key != -1)
+		slot = (slot + 1) & g->hash_mask;
+	return (slot);
+}
+
+/* grid_cell_items()
+	The objects of a cell: *count indices into acc->prims
+	Return a pointer to the first one
+*/
+int	*grid_cell_items(t_grid *g, int cell[3], int *count)
+{
+	long	key;
+	long	slot;
+
+	key = grid_cell_key(g, cell);
+	if (!g->slots)
+	{
+		*count = g->start[key + 1] - g->start[key];
+		return (g->items + g->start[key]);
+	}
+	slot = grid_slot(g, key);
+	*count = g->slots[slot].count;
+	return (g->items + g->slots[slot].start);
+}
+
+void	grid_free(t_grid *g)
+{
+	if (!g)
+		return ;
+	free(g->items);
+	free(g->start);
+	free(g->slots);
+	free(g->blocks);
+	free(g);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_fill_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:02:31 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:11:24 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* add_ref()
+	Counting pass (fill = 0): one more object in the cell, a cell of the
+	hashed grid gets its slot the first time.
+	Filling pass: the counter of the cell was turned into the end of its
+	range by prefix_sums(), the object goes right before it. Once all the
+	objects are in, the counter is the start of the cell's range.
+*/
+static void	add_ref(t_grid *g, long key, int prim, int fill)
+{
+	long	slot;
+
+	if (!g->slots && fill)
+		g->items[--g->start[key]] = prim;
+	else if (!g->slots)
+		g->start[key]++;
+	else
+	{
+		slot = grid_slot(g, key);
+		if (fill)
+			g->items[--g->slots[slot].start] = prim;
+		else
+		{
+			g->cell_count += (g->slots[slot].key == -1);
+			g->slots[slot].key = key;
+			g->slots[slot].count++;
+		}
+	}
+}
+
+// adds the object `prim` to every cell its box overlaps, and marks their
+// blocks as used
+static void	add_box(t_grid *g, t_aabb *box, int prim, int fill)
+{
+	int	lo[3];
+	int	hi[3];
+	int	c[3];
+
+	grid_span(g, box, lo, hi);
+	c[2] = lo[2] - 1;
+	while (++c[2] <= hi[2])
+	{
+		c[1] = lo[1] - 1;
+		while (++c[1] <= hi[1])
+		{
+			c[0] = lo[0] - 1;
+			while (++c[0] <= hi[0])
+			{
+				add_ref(g, grid_cell_key(g, c), prim, fill);
+				g->blocks[grid_block_key(g, c)] = 1;
+			}
+		}
+	}
+}
+
+// turns the counters of the cells into the end of their range of items
+static void	prefix_sums(t_grid *g)
+{
+	long	cells;
+	long	i;
+
+	if (g->slots)
+	{
+		g->slots[0].start = g->slots[0].count;
+		i = 0;
+		while (++i <= g->hash_mask)
+			g->slots[i].start = g->slots[i - 1].start + g->slots[i].count;
+		return ;
+	}
+	cells = (long)g->res[0] * g->res[1] * g->res[2];
+	g->cell_count = (g->start[0] > 0);
+	i = 0;
+	while (++i < cells)
+	{
+		g->cell_count += (g->start[i] > 0);
+		g->start[i] += g->start[i - 1];
+	}
+	g->start[cells] = g->item_count;
+}
+
+/* grid_fill()
+	Fills the cells in two passes over the objects: the first one counts
+	the objects of each cell, the second one puts them in, so that the
+	objects of a cell end up next to each other in g->items
+*/
+void	grid_fill(t_grid *g, t_aabb *boxes, int n)
+{
+	int	i;
+
+	i = -1;
+	while (++i < n)
+		add_box(g, &boxes[i], i, 0);
+	prefix_sums(g);
+	i = n;
+	while (--i >= 0)
+		add_box(g, &boxes[i], i, 1);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid_traverse_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:02:46 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* trav_axis()
+	Sets up the walk along one axis, t being where the ray enters the grid:
+	the cell it enters, the distance to the next boundary of the axis and
+	the distance across one cell. A ray parallel to the axis never crosses
+	a boundary of it: both distances are infinite.
+*/
+static void	trav_axis(t_grid *g, t_grid_trav *tr, int a, t_real t)
+{
+	t_real	o;
+	t_real	d;
+	t_real	cs;
+
+	o = vec3_axis(tr->ray->origin, a) - vec3_axis(g->box.min, a);
+	d = vec3_axis(tr->ray->direction, a);
+	cs = vec3_axis(g->cell, a);
+	tr->cell[a] = fmax(0.0, fmin(floor((o + d * t) / cs), g->res[a] - 1));
+	tr->step[a] = 1 - 2 * (d < 0.0);
+	tr->t_next[a] = INFINITY;
+	tr->t_delta[a] = INFINITY;
+	if (d == 0.0)
+		return ;
+	tr->t_next[a] = ((tr->cell[a] + (d > 0.0)) * cs - o) / d;
+	tr->t_delta[a] = cs / fabs(d);
+}
+
+/* trav_init()
+	Finds the cell where the ray enters the grid (or starts, inside it)
+	Return 0 if the ray misses the grid or enters it beyond t_max
+*/
+static int	trav_init(t_grid *g, t_grid_trav *tr, t_ray *ray, t_real t_max)
+{
+	t_real	t;
+
+	t = aabb_hit(&g->box, ray->origin, (t_vec3){1.0 / ray->direction.x,
+			1.0 / ray->direction.y, 1.0 / ray->direction.z}, t_max);
+	if (t == INFINITY)
+		return (0);
+	tr->ray = ray;
+	tr->t_max = t_max;
+	trav_axis(g, tr, 0, t);
+	trav_axis(g, tr, 1, t);
+	trav_axis(g, tr, 2, t);
+	return (1);
+}
+
+/* trav_step()
+	Moves to the next cell along the ray: across the closest boundary.
+	Return 0 once the ray leaves the grid, or when the next cell starts
+	beyond tr->t_max (a closer hit was found already)
+*/
+static int	trav_step(t_grid *g, t_grid_trav *tr)
+{
+	int	a;
+
+	a = 0;
+	if (tr->t_next[1] < tr->t_next[a])
+		a = 1;
+	if (tr->t_next[2] < tr->t_next[a])
+		a = 2;
+	if (tr->t_next[a] >= tr->t_max)
+		return (0);
+	tr->cell[a] += tr->step[a];
+	if (tr->cell[a] < 0 || tr->cell[a] >= g->res[a])
+		return (0);
+	tr->t_next[a] += tr->t_delta[a];
+	return (1);
+}
+
+/* test_cell()
+	Intersects the objects of the current cell, keeps the closest hit in
+	*rec and in tr->t_max. With rec NULL (shadow rays) any hit will do.
+	A hit may lie beyond the cell, in another cell the object overlaps:
+	it is kept, but the walk goes on until it reaches it (see trav_step()),
+	a closer object in between could still be hit.
+	Return 1 if a hit was found
+*/
+static int	test_cell(t_accel *acc, t_grid_trav *tr, t_hit_record *rec)
+{
+	t_hit_record	temp_rec;
+	int				*items;
+	int				count;
+	int				hit;
+	int				i;
+
+	items = grid_cell_items(acc->grid, tr->cell, &count);
+	temp_rec.t = tr->t_max;
+	hit = 0;
+	i = -1;
+	while (++i < count)
+	{
+		if (!prim_hit(acc, items[i], tr->ray, &temp_rec))
+			continue ;
+		if (!rec)
+			return (1);
+		*rec = temp_rec;
+		tr->t_max = temp_rec.t;
+		hit = 1;
+	}
+	return (hit);
+}
+
+/* grid_hit()
+	Walks the cells pierced by the ray, front to back (3D-DDA), until the
+	closest hit is known. Empty blocks of cells are crossed at once.
+	Input:
+		t_max:	the closest distance found so far (e.g. by the planes)
+		*rec:	overwritten by every closer hit, NULL for an occlusion
+				query: the first object hit closer than t_max ends the walk
+	Return 1 if a hit closer than t_max was found in the grid, 0 otherwise
+*/
+int	grid_hit(t_accel *acc, t_ray *ray, t_real t_max, t_hit_record *rec)
+{
+	t_grid_trav	tr;
+	int			hit;
+
+	if (!acc->grid || !trav_init(acc->grid, &tr, ray, t_max))
+		return (0);
+	hit = 0;
+	while (1)
+	{
+		if (!acc->grid->blocks[grid_block_key(acc->grid, tr.cell)])
+		{
+			if (!grid_skip_block(acc->grid, &tr))
+				return (hit);
+			continue ;
+		}
+		if (test_cell(acc, &tr, rec))
+		{
+			if (!rec)
+				return (1);
+			hit = 1;
+		}
+		if (!trav_step(acc->grid, &tr))
+			return (hit);
+	}
+}
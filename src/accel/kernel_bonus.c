@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:16:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 01:50:09 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the ray's terms the kernels share, computed as the intersection routines
+// do; any: an occlusion test, the kernels stop at the first primitive hit
+void	kernel_ray_init(t_kernel_ray *r, t_ray *ray, int any)
+{
+	r->o[0] = ray->origin.x;
+	r->o[1] = ray->origin.y;
+	r->o[2] = ray->origin.z;
+	r->d[0] = ray->direction.x;
+	r->d[1] = ray->direction.y;
+	r->d[2] = ray->direction.z;
+	r->dd = vec3_length_squared(ray->direction);
+	r->two_a = 2.0 * r->dd;
+	r->four_a = 4 * r->dd;
+	r->any = any;
+}
+
+/* kernel_pick()
+	The closest of the lanes of a kernel: lane[0] holds the distance each
+	lane kept, lane[1] its entry (-1: none closer than *t). On a tie the
+	first entry wins, as in a loop over them.
+	Return the entry, -1 if none, *t being set to its distance
+*/
+int	kernel_pick(double lane[2][8], int lanes, double *t)
+{
+	int	best;
+	int	i;
+
+	best = -1;
+	i = -1;
+	while (++i < lanes)
+	{
+		if (lane[1][i] >= 0 && (lane[0][i] < *t
+				|| (lane[0][i] == *t && lane[1][i] < best)))
+		{
+			*t = lane[0][i];
+			best = (int)lane[1][i];
+		}
+	}
+	return (best);
+}
+
+// the kernel of the SIMD level blk[2] and of the type of the run on the
+// blk[1] entries from blk[0], a multiple of its 1 << blk[2] lanes. The
+// cylinders and cones have no SSE2 kernel, they go through the scalar one.
+static int	block(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	if (r->type == SPHERE && blk[2] == SIMD_AVX512)
+		return (spheres_avx512(s, blk, r, t));
+	if (r->type == SPHERE && blk[2] == SIMD_AVX)
+		return (spheres_avx(s, blk, r, t));
+	if (r->type == SPHERE && blk[2] == SIMD_SSE)
+		return (spheres_sse(s, blk, r, t));
+	if (r->type != SPHERE && blk[2] == SIMD_AVX512)
+		return (quadrics_avx512(s, blk, r, t));
+	if (r->type != SPHERE && blk[2] == SIMD_AVX)
+		return (quadrics_avx(s, blk, r, t));
+	return (kernel_scalar(s, blk, r, t));
+}
+
+/* kernel_closest()
+	Tests the ray against a run of primitives of one type at once
+	Input:
+		*s:		the compiled primitives, s->simd the widest kernel to use
+		run:	the entries run[0] .. run[0] + run[1] - 1 of the arrays of
+				the type run[2]: spheres, cylinders or cones
+		*t:		the closest distance so far
+	Return the entry of the closest primitive hit closer than *t, -1 if
+	none, *t being set to its distance
+
+	The widest kernel takes as many blocks of its lanes as the run holds,
+	the next one down what is left, and so on to the scalar tail: 13
+	spheres with AVX-512 are a block of 8, one of 4 and a last one.
+	Each kernel keeps a primitive only if it is strictly closer than *t,
+	the blocks go in order: the first of equally close ones wins, as in a
+	loop over the intersection routines, which find the same distances.
+*/
+int	kernel_closest(t_prim_soa *s, int run[3], t_ray *ray, double *t)
+{
+	t_kernel_ray	r;
+	int				blk[3];
+	int				best;
+	int				k;
+
+	kernel_ray_init(&r, ray, 0);
+	r.type = run[2];
+	best = -1;
+	blk[0] = run[0];
+	blk[2] = s->simd;
+	while (blk[2] >= SIMD_NONE)
+	{
+		blk[1] = (run[0] + run[1] - blk[0]) >> blk[2] << blk[2];
+		if (blk[1] > 0)
+		{
+			k = block(s, blk, &r, t);
+			if (k >= 0)
+				best = k;
+			blk[0] += blk[1];
+		}
+		blk[2]--;
+	}
+	return (best);
+}
+
+// occlusion version: is any primitive of the run hit closer than t_max?
+int	kernel_any(t_prim_soa *s, int run[3], t_ray *ray, double t_max)
+{
+	t_kernel_ray	r;
+	int				blk[3];
+
+	kernel_ray_init(&r, ray, 1);
+	r.type = run[2];
+	blk[0] = run[0];
+	blk[2] = s->simd;
+	while (blk[2] >= SIMD_NONE)
+	{
+		blk[1] = (run[0] + run[1] - blk[0]) >> blk[2] << blk[2];
+		if (blk[1] > 0 && block(s, blk, &r, &t_max) >= 0)
+			return (1);
+		blk[0] += blk[1];
+		blk[2]--;
+	}
+	return (0);
+}
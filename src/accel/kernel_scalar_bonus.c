@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_scalar_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:16:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* sphere_root()
+	The distance hit_sphere() finds on the sphere at entry k, before
+	comparing it with t_max: the near root if it is past HIT_EPS, the far
+	one otherwise. The SIMD kernels compute the same, lane by lane, in the
+	same order, so that they find exactly the same distances.
+	Return the distance, INFINITY if the ray misses the sphere
+*/
+double	sphere_root(t_sphere_soa *sp, int k, t_kernel_ray *r)
+{
+	double	oc[3];
+	double	b;
+	double	disc;
+	double	t;
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		oc[i] = r->o[i] - sp->center[i][k];
+	b = 2 * (r->d[0] * oc[0] + r->d[1] * oc[1] + r->d[2] * oc[2]);
+	disc = b * b - r->four_a * (oc[0] * oc[0] + oc[1] * oc[1] + oc[2] * oc[2]
+			- sp->radius_sq[k]);
+	if (disc < 0)
+		return (INFINITY);
+	t = (-b - sqrt(disc)) / r->two_a;
+	if (t <= HIT_EPS)
+		t = (-b + sqrt(disc)) / r->two_a;
+	if (t <= HIT_EPS)
+		return (INFINITY);
+	return (t);
+}
+
+/* kernel_bound()
+	The first two tests of sphere_misses() on the bounding sphere at entry k
+	of a cylinder's or a cone's arrays: does the ray's line cross it, not
+	behind the origin? The bounding spheres are grown a little, rounding
+	never rejects a hit (see prim_bounds_init()).
+	Return 1 if the primitive has to be tested, 0 if it can't be hit
+*/
+int	kernel_bound(double *bound[4], int k, t_kernel_ray *r)
+{
+	double	oc[3];
+	double	b;
+	double	c;
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		oc[i] = r->o[i] - bound[i][k];
+	b = r->d[0] * oc[0] + r->d[1] * oc[1] + r->d[2] * oc[2];
+	c = oc[0] * oc[0] + oc[1] * oc[1] + oc[2] * oc[2] - bound[3][k];
+	return (!(b * b < r->dd * c || (c > 0.0 && b > 0.0)));
+}
+
+// the distance to the primitive at entry k of the arrays of the run's type
+static double	root(t_prim_soa *s, int k, t_kernel_ray *r)
+{
+	if (r->type == SPHERE)
+		return (sphere_root(&s->sp, k, r));
+	if (r->type == CYLINDER && kernel_bound(s->cy.bound, k, r))
+		return (cylinder_root(&s->cy, k, r));
+	if (r->type == CONE && kernel_bound(s->co.bound, k, r))
+		return (cone_root(&s->co, k, r));
+	return (INFINITY);
+}
+
+/* kernel_scalar()
+	The closest of the primitives blk[0] .. blk[0] + blk[1] - 1 of the
+	run's type hit closer than *t, one at a time (the tail of a run, past
+	the SIMD blocks). For an occlusion test (r->any), the first one hit
+	closer than *t.
+	Return the entry, -1 if none, *t being set to its distance
+*/
+int	kernel_scalar(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	double	dist;
+	int		best;
+	int		k;
+
+	best = -1;
+	k = blk[0] - 1;
+	while (++k < blk[0] + blk[1] && !(r->any && best >= 0))
+	{
+		dist = root(s, k, r);
+		if (dist < *t)
+		{
+			*t = dist;
+			best = k;
+		}
+	}
+	return (best);
+}
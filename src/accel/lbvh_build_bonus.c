@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lbvh_build_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:23:43 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:23:43 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* split_index()
+	Where the range of sorted codes [first, first + count) splits: the
+	codes of the range share all their bits above the highest one that
+	differs between its first and its last code, and those with that bit
+	set come last. They are found by binary search.
+	Identical codes (primitives in the same cell) are cut in two halves.
+	Return the number of primitives of the left child
+*/
+static int	split_index(unsigned int *codes, int first, int count)
+{
+	unsigned int	bit;
+	int				lo;
+	int				hi;
+	int				mid;
+
+	bit = codes[first] ^ codes[first + count - 1];
+	if (bit == 0)
+		return (count / 2);
+	bit = 1u << (31 - __builtin_clz(bit));
+	lo = first;
+	hi = first + count - 1;
+	while (hi - lo > 1)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (codes[mid] & bit)
+			hi = mid;
+		else
+			lo = mid;
+	}
+	return (hi - first);
+}
+
+/* lbvh_emit()
+	Builds the node `r.node` of the task `t` of a linear BVH, the way
+	bvh_subdivide() does, but with no box and no cost to compute: a node
+	is split where the Morton codes of its primitives change their highest
+	bit, which is what makes the build so fast. The boxes are computed
+	once the whole tree is there (see lbvh_finish()).
+*/
+void	lbvh_emit(t_bvh_build *b, t_bvh_task *t, t_bvh_range r)
+{
+	t_bvh_node	*node;
+	int			left;
+
+	node = &t->nodes[r.node];
+	node->left_first = r.first;
+	node->count = r.count;
+	if (r.count <= LBVH_MAX_LEAF || (t->spawn && r.count <= BVH_TASK_SIZE
+			&& bvh_add_task(b, r)))
+		return ;
+	left = split_index(b->codes, r.first, r.count);
+	node->left_first = t->node_count;
+	node->count = 0;
+	t->node_count += 2;
+	lbvh_emit(b, t, (t_bvh_range){node->left_first, r.first, left,
+		r.depth + 1});
+	lbvh_emit(b, t, (t_bvh_range){node->left_first + 1, r.first + left,
+		r.count - left, r.depth + 1});
+}
+
+// the rotations that swap `other` with a child of its sibling `child`:
+// `child` gets the other one of its children and `other` as its children
+static void	try_rotations(t_bvh_node *n, int child, int other,
+		t_bvh_rotation *best)
+{
+	t_aabb	box;
+	double	gain;
+	int		k;
+
+	if (n[child].count > 0)
+		return ;
+	k = -1;
+	while (++k < 2)
+	{
+		box = aabb_union(n[other].box, n[n[child].left_first + 1 - k].box);
+		gain = aabb_area(n[child].box) - aabb_area(box);
+		if (gain > best->gain)
+			*best = (t_bvh_rotation){gain, other, n[child].left_first + k,
+				child};
+	}
+}
+
+/* rotate()
+	Tree rotation at the inner node i (Kensler 2008): of the 4 ways to swap
+	a child of i with a grandchild, applies the one that shrinks the box of
+	the child it changes the most, if any. The box of i doesn't change.
+	The two subtrees are swapped by swapping their root nodes.
+*/
+static void	rotate(t_bvh_node *n, int i)
+{
+	t_bvh_rotation	best;
+	t_bvh_node		tmp;
+	int				c;
+
+	best = (t_bvh_rotation){0.0, -1, -1, -1};
+	c = n[i].left_first;
+	try_rotations(n, c, c + 1, &best);
+	try_rotations(n, c + 1, c, &best);
+	if (best.a < 0)
+		return ;
+	tmp = n[best.a];
+	n[best.a] = n[best.b];
+	n[best.b] = tmp;
+	c = n[best.parent].left_first;
+	n[best.parent].box = aabb_union(n[c].box, n[c + 1].box);
+}
+
+/* lbvh_finish()
+	Computes the boxes of the linear BVH, bottom-up: the children of a node
+	always come after it in acc->nodes, one backward pass sees every node
+	after its children. With --build lbvh-opt, every inner node is then
+	rotated, once its subtrees are done.
+*/
+void	lbvh_finish(t_accel *acc, t_bvh_build *b)
+{
+	t_bvh_node	*node;
+	int			i;
+
+	i = acc->node_count;
+	while (--i >= 0)
+	{
+		node = &acc->nodes[i];
+		if (node->count > 0)
+			node->box = bvh_range_bounds(b, node->left_first, node->count);
+		else
+		{
+			node->box = aabb_union(acc->nodes[node->left_first].box,
+					acc->nodes[node->left_first + 1].box);
+			if (acc->builder == BUILD_LBVH_OPT)
+				rotate(acc->nodes, i);
+		}
+	}
+}
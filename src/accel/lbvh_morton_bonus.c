@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lbvh_morton_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:23:43 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:23:43 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// spreads the 10 low bits of v out to every third bit: 0b11 -> 0b1001
+static unsigned int	spread_bits(unsigned int v)
+{
+	v = (v * 0x00010001u) & 0xFF0000FFu;
+	v = (v * 0x00000101u) & 0x0F00F00Fu;
+	v = (v * 0x00000011u) & 0xC30C30C3u;
+	v = (v * 0x00000005u) & 0x49249249u;
+	return (v);
+}
+
+// cells of the Morton grid per unit of length along an axis of that extent
+static double	axis_scale(double extent)
+{
+	if (extent <= 0.0)
+		return (0.0);
+	return (((1 << LBVH_MORTON_BITS) - 1) / extent);
+}
+
+/* lbvh_codes()
+	Thread routine: the Morton code of the centroid of each primitive of
+	the worker's slice, i.e. its cell in a 1024^3 grid over the centroid
+	bounds with the bits of x, y and z interleaved. Sorted, the codes put
+	the primitives in Z-order: the closer in space, the closer in the list.
+*/
+void	*lbvh_codes(void *arg)
+{
+	t_lbvh_worker	*w;
+	t_lbvh_sort		*s;
+	t_vec3			p;
+	int				i;
+
+	w = arg;
+	s = w->s;
+	i = w->first - 1;
+	while (++i < w->end)
+	{
+		p = vec3_sub(s->b->centroids[i], s->origin);
+		s->keys[0][i] = (spread_bits(p.x * s->scale.x) << 2)
+			| (spread_bits(p.y * s->scale.y) << 1)
+			| spread_bits(p.z * s->scale.z);
+	}
+	return (NULL);
+}
+
+/* lbvh_sort_init()
+	Allocates the buffers of the sort and computes the bounds of the
+	centroids. The values of the first buffer are b->idx itself, sorted in
+	place. Small scenes are sorted on a single thread.
+	Return 1 on success, 0 on allocation failure (nothing left allocated)
+*/
+int	lbvh_sort_init(t_lbvh_sort *s, t_bvh_build *b)
+{
+	t_aabb	box;
+	int		n;
+	int		i;
+
+	n = b->acc->prim_count;
+	*s = (t_lbvh_sort){.b = b, .threads = 1, .vals[0] = b->idx};
+	if (n >= LBVH_SORT_SIZE)
+		s->threads = b->threads;
+	box = aabb_empty();
+	i = -1;
+	while (++i < n)
+		box = aabb_union(box, (t_aabb){b->centroids[i], b->centroids[i]});
+	s->origin = box.min;
+	s->scale = (t_vec3){axis_scale(box.max.x - box.min.x),
+		axis_scale(box.max.y - box.min.y), axis_scale(box.max.z - box.min.z)};
+	s->keys[0] = malloc(sizeof(unsigned int) * n);
+	s->keys[1] = malloc(sizeof(unsigned int) * n);
+	s->vals[1] = malloc(sizeof(int) * n);
+	s->hist = malloc(sizeof(int) * LBVH_RADIX * s->threads);
+	if (s->keys[0] && s->keys[1] && s->vals[1] && s->hist)
+		return (1);
+	return (free(s->keys[0]), free(s->keys[1]), free(s->vals[1]),
+		free(s->hist), 0);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lbvh_sort_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:23:43 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:23:43 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// thread routine: counts the digits of the current pass in the worker's slice
+static void	*count_digits(void *arg)
+{
+	t_lbvh_worker	*w;
+	unsigned int	*keys;
+	int				i;
+
+	w = arg;
+	keys = w->s->keys[w->s->src];
+	ft_bzero(w->hist, sizeof(int) * LBVH_RADIX);
+	i = w->first - 1;
+	while (++i < w->end)
+		w->hist[(keys[i] >> w->s->shift) & (LBVH_RADIX - 1)]++;
+	return (NULL);
+}
+
+/* digit_offsets()
+	Turns the counts into the index where each thread writes its first key
+	of each digit: all the smaller digits come first, then the same digit
+	from the threads before it. This keeps every pass stable, which LSD
+	radix sort relies on.
+*/
+static void	digit_offsets(t_lbvh_sort *s)
+{
+	int	sum;
+	int	count;
+	int	d;
+	int	t;
+
+	sum = 0;
+	d = -1;
+	while (++d < LBVH_RADIX)
+	{
+		t = -1;
+		while (++t < s->threads)
+		{
+			count = s->hist[t * LBVH_RADIX + d];
+			s->hist[t * LBVH_RADIX + d] = sum;
+			sum += count;
+		}
+	}
+}
+
+// thread routine: moves the keys of the worker's slice, with their values,
+// to their place in the other buffer
+static void	*scatter(void *arg)
+{
+	t_lbvh_worker	*w;
+	t_lbvh_sort		*s;
+	unsigned int	key;
+	int				*pos;
+	int				i;
+
+	w = arg;
+	s = w->s;
+	i = w->first - 1;
+	while (++i < w->end)
+	{
+		key = s->keys[s->src][i];
+		pos = &w->hist[(key >> s->shift) & (LBVH_RADIX - 1)];
+		s->keys[!s->src][*pos] = key;
+		s->vals[!s->src][(*pos)++] = s->vals[s->src][i];
+	}
+	return (NULL);
+}
+
+// runs `phase` on every worker, the first one on the calling thread.
+// A thread that can't be started has its slice done there as well.
+static void	run_phase(t_lbvh_sort *s, t_lbvh_worker *w, void *(*phase)(void *))
+{
+	pthread_t	tids[RT_MAX_THREADS];
+	int			started[RT_MAX_THREADS];
+	int			i;
+
+	i = 0;
+	while (++i < s->threads)
+		started[i] = (pthread_create(&tids[i], NULL, phase, &w[i]) == 0);
+	phase(&w[0]);
+	i = 0;
+	while (++i < s->threads)
+	{
+		if (started[i])
+			pthread_join(tids[i], NULL);
+		else
+			phase(&w[i]);
+	}
+}
+
+/* lbvh_sort()
+	Computes the Morton codes of the primitives and sorts b->idx by code,
+	in parallel: 4 passes of 8 bits, the keys go back and forth between
+	the two buffers and end up in the first one, which becomes b->codes.
+	Return 1 on success, 0 on allocation failure
+*/
+int	lbvh_sort(t_bvh_build *b)
+{
+	t_lbvh_sort		s;
+	t_lbvh_worker	w[RT_MAX_THREADS];
+	long			n;
+	int				i;
+
+	if (!lbvh_sort_init(&s, b))
+		return (0);
+	n = b->acc->prim_count;
+	i = -1;
+	while (++i < s.threads)
+		w[i] = (t_lbvh_worker){&s, s.hist + i * LBVH_RADIX,
+			n * i / s.threads, n * (i + 1) / s.threads};
+	run_phase(&s, w, lbvh_codes);
+	while (s.shift < 32)
+	{
+		run_phase(&s, w, count_digits);
+		digit_offsets(&s);
+		run_phase(&s, w, scatter);
+		s.shift += LBVH_RADIX_BITS;
+		s.src = !s.src;
+	}
+	b->codes = s.keys[0];
+	return (free(s.keys[1]), free(s.vals[1]), free(s.hist), 1);
+}
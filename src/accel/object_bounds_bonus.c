@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   object_bounds_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:57:50 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:32:22 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static t_aabb	sphere_bounds(t_sphere *sp)
+{
+	t_vec3	r;
+
+	r = (t_vec3){sp->radius, sp->radius, sp->radius};
+	return ((t_aabb){vec3_sub(sp->center, r), vec3_add(sp->center, r)});
+}
+
+/* disc_bounds()
+	Exact box of a disc of radius r around `center`, facing `axis` (unit):
+	along the world axis i, the disc reaches r * sqrt(1 - axis_i²) away
+	from its center, e.g. nothing along its own axis, r across it.
+*/
+static t_aabb	disc_bounds(t_point3 center, t_vec3 axis, double r)
+{
+	t_vec3	e;
+
+	e.x = r * sqrt(fmax(0.0, 1.0 - axis.x * axis.x));
+	e.y = r * sqrt(fmax(0.0, 1.0 - axis.y * axis.y));
+	e.z = r * sqrt(fmax(0.0, 1.0 - axis.z * axis.z));
+	return ((t_aabb){vec3_sub(center, e), vec3_add(center, e)});
+}
+
+/* cylinder_bounds()
+	The cylinder lies between its base cap center (cy->center) and its top
+	cap center: its box is the box of its two cap discs. For a cylinder at
+	45 degrees, that is about 30% less wide than the segment between the
+	cap centers grown by the radius in every direction.
+*/
+static t_aabb	cylinder_bounds(t_cylinder *cy)
+{
+	t_point3	top;
+
+	top = vec3_add(cy->center, vec3_mul(cy->axis, cy->height));
+	return (aabb_union(disc_bounds(cy->center, cy->axis, cy->diameter / 2.0),
+			disc_bounds(top, cy->axis, cy->diameter / 2.0)));
+}
+
+/* cone_bounds()
+	Same idea as for the cylinder: the box of the tip and of the base disc,
+	whose radius is
+		radius = height * tan(angle) = height * sqrt(1 / cos²(angle) - 1)
+*/
+static t_aabb	cone_bounds(t_cone *co)
+{
+	t_point3	base;
+	double		radius;
+
+	base = vec3_add(co->tip, vec3_mul(co->axis, co->height));
+	radius = co->height * sqrt(1.0 / co->cos_angle_sq - 1.0);
+	return (aabb_union((t_aabb){co->tip, co->tip},
+		disc_bounds(base, co->axis, radius)));
+}
+
+/* object_bounds()
+	Returns an axis-aligned box enclosing the whole object
+	Planes are infinite and must not be asked for their bounds,
+	they get an empty box.
+*/
+t_aabb	object_bounds(t_object *obj)
+{
+	if (obj->type == SPHERE)
+		return (sphere_bounds(obj->shape_data));
+	if (obj->type == CYLINDER)
+		return (cylinder_bounds(obj->shape_data));
+	if (obj->type == CONE)
+		return (cone_bounds(obj->shape_data));
+	if (obj->type == INSTANCE)
+		return (instance_bounds(obj->shape_data));
+	return (aabb_empty());
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_any_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:29:08 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:45:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the rays of mask m not blocked yet against the primitives of a leaf: the
+// bounding sphere of each is tested across the rays first, as in
+// packet_walk(), and a ray stops at the first primitive that blocks it
+static void	block_leaf(t_accel *acc, t_packet *pk, t_bvh_node *node,
+		unsigned long m)
+{
+	unsigned long	pass;
+	int				p;
+	int				i;
+
+	p = node->left_first - 1;
+	while (++p < node->left_first + node->count)
+	{
+		pass = m & ~pk->hit;
+		if (pass && acc->soa.type[p] != INSTANCE)
+			pass = packet_cull(pk, &acc->soa, p, pass);
+		while (pass)
+		{
+			i = __builtin_ctzl(pass);
+			pass &= pass - 1;
+			if ((acc->soa.type[p] == INSTANCE
+					&& prim_occludes(acc, p, &pk->ray[i], pk->rec[i].t))
+				|| (acc->soa.type[p] != INSTANCE
+					&& prim_blocks(acc, p, &pk->ray[i], pk->rec[i].t)))
+				pk->hit |= 1UL << i;
+		}
+	}
+}
+
+/* any_walk()
+	Walks the binary BVH with the rays of the packet that no plane blocks,
+	as packet_walk() does, with an occlusion test at the leaves. There is
+	no closest hit to get to first, the children are visited in any order.
+	A ray blocked leaves the masks at once, the walk ends when all are.
+*/
+static void	any_walk(t_accel *acc, t_packet *pk, unsigned long all)
+{
+	t_packet_trav	tr;
+	t_bvh_node		*node;
+	unsigned long	m;
+
+	tr.stack[0] = 0;
+	tr.mask[0] = all & ~pk->hit;
+	tr.sp = 1;
+	while (tr.sp-- > 0 && pk->hit != all)
+	{
+		node = &acc->nodes[tr.stack[tr.sp]];
+		m = packet_box(pk, &node->box, tr.mask[tr.sp] & ~pk->hit);
+		if (m == 0)
+			continue ;
+		if (node->count > 0)
+			block_leaf(acc, pk, node, m);
+		else if (tr.sp + 2 <= BVH_STACK_SIZE)
+		{
+			tr.stack[tr.sp] = node->left_first + 1;
+			tr.stack[tr.sp + 1] = node->left_first;
+			tr.mask[tr.sp] = m;
+			tr.mask[tr.sp + 1] = m;
+			tr.sp += 2;
+		}
+	}
+}
+
+/* packet_any_hit()
+	The occlusion query of the shadow rays of the packet, each up to
+	pk->rec[i].t, as accel_any_hit() would answer it one ray at a time:
+	bit i of pk->hit is set if something blocks ray i. The rays are
+	counted, tested against the planes first, then walk the binary BVH
+	together (see any_walk()); through the other accels they go one by one.
+*/
+void	packet_any_hit(t_accel *acc, t_packet *pk)
+{
+	int	i;
+
+	pk->simd = acc->soa.simd;
+	pk->hit = 0;
+	i = -1;
+	if (acc->kind != ACCEL_BVH)
+	{
+		while (++i < pk->n)
+			if (accel_any_hit(acc, &pk->ray[i], pk->rec[i].t))
+				pk->hit |= 1UL << i;
+		return ;
+	}
+	while (++i < pk->n)
+	{
+		prim_stats()->shadow_rays++;
+		if (prim_occludes_range(acc, (int [2]){acc->prim_count,
+				acc->soa.total}, &pk->ray[i], pk->rec[i].t))
+			pk->hit |= 1UL << i;
+	}
+	packet_lanes(pk);
+	if (acc->node_count > 0)
+		any_walk(acc, pk, ~0UL >> (PACKET_MAX - pk->n));
+}
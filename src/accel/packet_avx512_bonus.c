@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_avx512_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:11:09 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:32:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+// box_avx() for the rays k .. k + 7
+__attribute__((target("avx512f")))
+static int	box_avx512(t_packet *pk, double b[2][3], int k)
+{
+	__m512d	t0;
+	__m512d	t1;
+	__m512d	lo;
+	__m512d	hi;
+	int		a;
+
+	lo = _mm512_setzero_pd();
+	hi = _mm512_loadu_pd(pk->t + k);
+	a = -1;
+	while (++a < 3)
+	{
+		t0 = _mm512_mul_pd(_mm512_sub_pd(_mm512_set1_pd(b[0][a]),
+					_mm512_loadu_pd(pk->o[a] + k)), _mm512_loadu_pd(pk->inv[a]
+					+ k));
+		t1 = _mm512_mul_pd(_mm512_sub_pd(_mm512_set1_pd(b[1][a]),
+					_mm512_loadu_pd(pk->o[a] + k)), _mm512_loadu_pd(pk->inv[a]
+					+ k));
+		lo = _mm512_max_pd(_mm512_min_pd(t0, t1), lo);
+		hi = _mm512_min_pd(_mm512_max_pd(t0, t1), hi);
+	}
+	return (_mm512_cmp_pd_mask(lo, hi, _CMP_LE_OQ));
+}
+
+/* packet_box_avx512()
+	packet_box() 8 rays at a time, with AVX-512F (see packet_box_avx()):
+	an 8x8 packet is 8 blocks, one per row of pixels
+*/
+__attribute__((target("avx512f")))
+unsigned long	packet_box_avx512(t_packet *pk, t_aabb *box, unsigned long m)
+{
+	double			b[2][3];
+	unsigned long	in;
+	int				k;
+
+	b[0][0] = box->min.x;
+	b[0][1] = box->min.y;
+	b[0][2] = box->min.z;
+	b[1][0] = box->max.x;
+	b[1][1] = box->max.y;
+	b[1][2] = box->max.z;
+	in = 0;
+	k = 0;
+	while (k < PACKET_MAX && (m >> k))
+	{
+		if ((m >> k) & 0xFF)
+			in |= ((unsigned long)box_avx512(pk, b, k) & (m >> k) & 0xFF)
+				<< k;
+		k += 8;
+	}
+	_mm256_zeroupper();
+	return (in);
+}
+
+// terms_avx() for the rays k .. k + 7 (at[1])
+__attribute__((target("avx512f")))
+static void	terms_avx512(t_packet *pk, double *bound[4], int at[2],
+		__m512d bc[2])
+{
+	__m512d	oc[3];
+	__m512d	d[3];
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm512_sub_pd(_mm512_loadu_pd(pk->o[i] + at[1]),
+				_mm512_set1_pd(bound[i][at[0]]));
+		d[i] = _mm512_loadu_pd(pk->d[i] + at[1]);
+	}
+	bc[0] = dot_avx512(d, oc);
+	bc[1] = _mm512_sub_pd(dot_avx512(oc, oc),
+			_mm512_set1_pd(bound[3][at[0]]));
+}
+
+// cull_avx() for the rays k .. k + 7 (at[1])
+__attribute__((target("avx512f")))
+static int	cull_avx512(t_packet *pk, double *bound[4], int at[2])
+{
+	__m512d		bc[2];
+	__m512d		a;
+	__m512d		far;
+	__mmask8	miss;
+
+	terms_avx512(pk, bound, at, bc);
+	a = _mm512_loadu_pd(pk->dd + at[1]);
+	miss = _mm512_cmp_pd_mask(_mm512_mul_pd(bc[0], bc[0]),
+			_mm512_mul_pd(a, bc[1]), _CMP_LT_OQ)
+		| (_mm512_cmp_pd_mask(bc[1], _mm512_setzero_pd(), _CMP_GT_OQ)
+			& _mm512_cmp_pd_mask(bc[0], _mm512_setzero_pd(), _CMP_GT_OQ));
+	far = _mm512_sub_pd(_mm512_sub_pd(_mm512_setzero_pd(), bc[0]),
+			_mm512_mul_pd(a, _mm512_loadu_pd(pk->t + at[1])));
+	miss |= _mm512_cmp_pd_mask(far, _mm512_setzero_pd(), _CMP_GT_OQ)
+		& _mm512_cmp_pd_mask(_mm512_mul_pd(far, far), _mm512_sub_pd(
+				_mm512_mul_pd(bc[0], bc[0]), _mm512_mul_pd(a, bc[1])),
+			_CMP_GT_OQ);
+	return (~miss & 0xFF);
+}
+
+// packet_cull() 8 rays at a time, with AVX-512F
+__attribute__((target("avx512f")))
+unsigned long	packet_cull_avx512(t_packet *pk, double *bound[4], int p,
+		unsigned long m)
+{
+	unsigned long	pass;
+	int				k;
+
+	pass = 0;
+	k = 0;
+	while (k < PACKET_MAX && (m >> k))
+	{
+		if ((m >> k) & 0xFF)
+			pass |= ((unsigned long)cull_avx512(pk, bound, (int [2]){p, k})
+					& (m >> k) & 0xFF) << k;
+		k += 8;
+	}
+	_mm256_zeroupper();
+	return (pass);
+}
+#endif
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_avx_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:10:55 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:19:59 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+// the slab test of aabb_hit() for the rays k .. k + 3 of the packet, the
+// box being b[0] (min) and b[1] (max): the NaN of a ray starting on a slab
+// parallel to it falls back to the previous bound, as in wbvh_test_sse()
+__attribute__((target("avx")))
+static int	box_avx(t_packet *pk, double b[2][3], int k)
+{
+	__m256d	t0;
+	__m256d	t1;
+	__m256d	lo;
+	__m256d	hi;
+	int		a;
+
+	lo = _mm256_setzero_pd();
+	hi = _mm256_loadu_pd(pk->t + k);
+	a = -1;
+	while (++a < 3)
+	{
+		t0 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(b[0][a]),
+					_mm256_loadu_pd(pk->o[a] + k)), _mm256_loadu_pd(pk->inv[a]
+					+ k));
+		t1 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(b[1][a]),
+					_mm256_loadu_pd(pk->o[a] + k)), _mm256_loadu_pd(pk->inv[a]
+					+ k));
+		lo = _mm256_max_pd(_mm256_min_pd(t0, t1), lo);
+		hi = _mm256_min_pd(_mm256_max_pd(t0, t1), hi);
+	}
+	return (_mm256_movemask_pd(_mm256_cmp_pd(lo, hi, _CMP_LE_OQ)));
+}
+
+/* packet_box_avx()
+	packet_box() 4 rays at a time, with AVX. The blocks of 4 rays without
+	any ray of m are skipped. Only called if the CPU supports it (see
+	kernel_simd_level()), the upper halves of the registers are cleared
+	before returning.
+*/
+__attribute__((target("avx")))
+unsigned long	packet_box_avx(t_packet *pk, t_aabb *box, unsigned long m)
+{
+	double			b[2][3];
+	unsigned long	in;
+	int				k;
+
+	b[0][0] = box->min.x;
+	b[0][1] = box->min.y;
+	b[0][2] = box->min.z;
+	b[1][0] = box->max.x;
+	b[1][1] = box->max.y;
+	b[1][2] = box->max.z;
+	in = 0;
+	k = 0;
+	while (k < PACKET_MAX && (m >> k))
+	{
+		if ((m >> k) & 0xF)
+			in |= ((unsigned long)box_avx(pk, b, k) & (m >> k) & 0xF) << k;
+		k += 4;
+	}
+	_mm256_zeroupper();
+	return (in);
+}
+
+// b and c of sphere_misses() for the rays k .. k + 3 (at[1]) and the
+// bounding sphere of primitive at[0], with the same operations
+__attribute__((target("avx")))
+static void	terms_avx(t_packet *pk, double *bound[4], int at[2],
+		__m256d bc[2])
+{
+	__m256d	oc[3];
+	__m256d	d[3];
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm256_sub_pd(_mm256_loadu_pd(pk->o[i] + at[1]),
+				_mm256_set1_pd(bound[i][at[0]]));
+		d[i] = _mm256_loadu_pd(pk->d[i] + at[1]);
+	}
+	bc[0] = dot_avx(d, oc);
+	bc[1] = _mm256_sub_pd(dot_avx(oc, oc), _mm256_set1_pd(bound[3][at[0]]));
+}
+
+/* cull_avx()
+	sphere_misses() for the rays k .. k + 3 (at[1]): each of its three
+	tests, compared as it compares them (a NaN misses nothing)
+	Return the mask of the rays that do not miss the bounding sphere
+*/
+__attribute__((target("avx")))
+static int	cull_avx(t_packet *pk, double *bound[4], int at[2])
+{
+	__m256d	bc[2];
+	__m256d	a;
+	__m256d	far;
+	__m256d	miss;
+
+	terms_avx(pk, bound, at, bc);
+	a = _mm256_loadu_pd(pk->dd + at[1]);
+	miss = _mm256_or_pd(_mm256_cmp_pd(_mm256_mul_pd(bc[0], bc[0]),
+				_mm256_mul_pd(a, bc[1]), _CMP_LT_OQ), _mm256_and_pd(
+				_mm256_cmp_pd(bc[1], _mm256_setzero_pd(), _CMP_GT_OQ),
+				_mm256_cmp_pd(bc[0], _mm256_setzero_pd(), _CMP_GT_OQ)));
+	far = _mm256_sub_pd(_mm256_sub_pd(_mm256_setzero_pd(), bc[0]),
+			_mm256_mul_pd(a, _mm256_loadu_pd(pk->t + at[1])));
+	miss = _mm256_or_pd(miss, _mm256_and_pd(_mm256_cmp_pd(far,
+					_mm256_setzero_pd(), _CMP_GT_OQ), _mm256_cmp_pd(
+					_mm256_mul_pd(far, far), _mm256_sub_pd(_mm256_mul_pd(
+							bc[0], bc[0]), _mm256_mul_pd(a, bc[1])),
+					_CMP_GT_OQ)));
+	return (~_mm256_movemask_pd(miss) & 0xF);
+}
+
+// packet_cull() 4 rays at a time, with AVX (see packet_box_avx())
+__attribute__((target("avx")))
+unsigned long	packet_cull_avx(t_packet *pk, double *bound[4], int p,
+		unsigned long m)
+{
+	unsigned long	pass;
+	int				k;
+
+	pass = 0;
+	k = 0;
+	while (k < PACKET_MAX && (m >> k))
+	{
+		if ((m >> k) & 0xF)
+			pass |= ((unsigned long)cull_avx(pk, bound, (int [2]){p, k})
+					& (m >> k) & 0xF) << k;
+		k += 4;
+	}
+	_mm256_zeroupper();
+	return (pass);
+}
+#endif
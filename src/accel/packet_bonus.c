@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:10:08 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:45:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// ray i against the planes, in their order, but those behind the whole tile
+// (see frustum_planes())
+static int	hit_planes(t_accel *acc, t_packet *pk, int i)
+{
+	int	hit;
+	int	k;
+
+	hit = 0;
+	k = -1;
+	while (++k < acc->plane_count)
+		if ((k >= 64 || !(pk->planes >> k & 1))
+			&& prim_hit(acc, acc->prim_count + k, &pk->ray[i], &pk->rec[i]))
+			hit = 1;
+	return (hit);
+}
+
+/* packet_lanes()
+	Copies the rays of the packet, with 1 / their directions and rec[i].t,
+	into the lanes of the arrays of doubles the SIMD tests read. The lanes
+	past the last ray get copies of ray 0: those tests read whole blocks of
+	lanes, the masks drop the extra ones.
+*/
+void	packet_lanes(t_packet *pk)
+{
+	int	r;
+	int	i;
+
+	i = -1;
+	while (++i < (pk->n + 7) / 8 * 8)
+	{
+		r = i * (i < pk->n);
+		if (i < pk->n)
+			pk->inv_dir[i] = (t_vec3){1.0 / pk->ray[i].direction.x,
+				1.0 / pk->ray[i].direction.y, 1.0 / pk->ray[i].direction.z};
+		pk->o[0][i] = pk->ray[r].origin.x;
+		pk->o[1][i] = pk->ray[r].origin.y;
+		pk->o[2][i] = pk->ray[r].origin.z;
+		pk->d[0][i] = pk->ray[r].direction.x;
+		pk->d[1][i] = pk->ray[r].direction.y;
+		pk->d[2][i] = pk->ray[r].direction.z;
+		pk->inv[0][i] = pk->inv_dir[r].x;
+		pk->inv[1][i] = pk->inv_dir[r].y;
+		pk->inv[2][i] = pk->inv_dir[r].z;
+		pk->dd[i] = vec3_length_squared(pk->ray[r].direction);
+		pk->t[i] = pk->rec[r].t;
+	}
+}
+
+/* packet_closest_hit()
+	Finds the closest hit of each ray of the packet, as accel_closest_hit()
+	would one ray at a time: pk->rec[i] is set and bit i of pk->hit is set
+	if ray i hits anything. The planes come first, as for a ray alone. The
+	rays of a packet walk the binary BVH together (see packet_walk()),
+	through the other accels they go one by one. The rays are those of a
+	tile, and pk->fr its frustum: the planes, nodes and primitives outside
+	of it are skipped by all of them at once.
+*/
+void	packet_closest_hit(t_accel *acc, t_packet *pk)
+{
+	int	i;
+
+	pk->simd = acc->soa.simd;
+	pk->hit = 0;
+	pk->planes = frustum_planes(&pk->fr, &acc->soa, acc->prim_count);
+	i = -1;
+	while (++i < pk->n)
+	{
+		prim_stats()->rays++;
+		pk->rec[i].t = REAL_MAX;
+		if (hit_planes(acc, pk, i))
+			pk->hit |= 1UL << i;
+	}
+	packet_lanes(pk);
+	if (acc->kind == ACCEL_BVH)
+	{
+		packet_walk(acc, pk);
+		return ;
+	}
+	i = -1;
+	while (++i < pk->n)
+		if (accel_hit_prims(acc, &pk->ray[i], &pk->rec[i]))
+			pk->hit |= 1UL << i;
+}
+
+/* packet_box()
+	The rays of mask m that cross the box before their closest hit so far,
+	4 or 8 of them at a time with the SIMD levels, else one by one with
+	aabb_hit()
+	Return the mask of those rays
+*/
+unsigned long	packet_box(t_packet *pk, t_aabb *box, unsigned long m)
+{
+	unsigned long	in;
+	int				i;
+
+	if (pk->simd == SIMD_AVX512)
+		return (packet_box_avx512(pk, box, m));
+	if (pk->simd == SIMD_AVX)
+		return (packet_box_avx(pk, box, m));
+	in = 0;
+	while (m)
+	{
+		i = __builtin_ctzl(m);
+		m &= m - 1;
+		if (aabb_hit(box, pk->ray[i].origin, pk->inv_dir[i], pk->rec[i].t)
+			!= INFINITY)
+			in |= 1UL << i;
+	}
+	return (in);
+}
+
+/* packet_cull()
+	prim_culled() for the rays of mask m against primitive p (not an
+	instance): its bounding sphere test, across 4 or 8 rays at a time with
+	the SIMD levels, which count the tests as prim_culled() does
+	Return the mask of the rays that have to test the primitive itself
+*/
+unsigned long	packet_cull(t_packet *pk, t_prim_soa *s, int p, unsigned long m)
+{
+	unsigned long	pass;
+	int				i;
+
+	if (pk->simd == SIMD_AVX512 || pk->simd == SIMD_AVX)
+	{
+		if (pk->simd == SIMD_AVX512)
+			pass = packet_cull_avx512(pk, s->bound, p, m);
+		else
+			pass = packet_cull_avx(pk, s->bound, p, m);
+		prim_stats()->tests[s->type[p]] += __builtin_popcountl(m);
+		prim_stats()->culled[s->type[p]] += __builtin_popcountl(m & ~pass);
+		return (pass);
+	}
+	pass = 0;
+	while (m)
+	{
+		i = __builtin_ctzl(m);
+		m &= m - 1;
+		if (!prim_culled(s, p, &pk->ray[i], pk->rec[i].t))
+			pass |= 1UL << i;
+	}
+	return (pass);
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_nosimd_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:11:17 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:19:59 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifndef SIMD_KERNELS
+
+// other CPUs and the float build: kernel_simd_level() is SIMD_NONE, the
+// packets test their rays one by one and never get here. Were they called,
+// keeping every ray of m would only cost the exact tests that follow.
+unsigned long	packet_box_avx(t_packet *pk, t_aabb *box, unsigned long m)
+{
+	(void)pk;
+	(void)box;
+	return (m);
+}
+
+unsigned long	packet_cull_avx(t_packet *pk, double *bound[4], int p,
+		unsigned long m)
+{
+	(void)pk;
+	(void)bound;
+	(void)p;
+	return (m);
+}
+
+unsigned long	packet_box_avx512(t_packet *pk, t_aabb *box, unsigned long m)
+{
+	(void)pk;
+	(void)box;
+	return (m);
+}
+
+unsigned long	packet_cull_avx512(t_packet *pk, double *bound[4], int p,
+		unsigned long m)
+{
+	(void)pk;
+	(void)bound;
+	(void)p;
+	return (m);
+}
+#endif
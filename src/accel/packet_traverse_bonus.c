@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_traverse_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:10:21 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:26:41 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// ray i tests primitive p for a closer hit: an instance goes through
+// prim_hit(), any other primitive passed its bounding sphere test already
+static void	record(t_accel *acc, t_packet *pk, int p, int i)
+{
+	int	hit;
+
+	if (acc->soa.type[p] == INSTANCE)
+		hit = prim_hit(acc, p, &pk->ray[i], &pk->rec[i]);
+	else
+		hit = prim_record(acc, p, &pk->ray[i], &pk->rec[i]);
+	if (!hit)
+		return ;
+	pk->hit |= 1UL << i;
+	pk->t[i] = pk->rec[i].t;
+}
+
+// the rays of mask m against the primitives of a leaf, in their order:
+// the bounding sphere of each is tested against the frustum of the tile,
+// then across the rays
+static void	hit_leaf(t_accel *acc, t_packet *pk, t_bvh_node *node,
+		unsigned long m)
+{
+	unsigned long	pass;
+	int				p;
+
+	p = node->left_first - 1;
+	while (++p < node->left_first + node->count)
+	{
+		pass = m;
+		if (acc->soa.type[p] != INSTANCE
+			&& frustum_sphere(&pk->fr, &acc->soa, p))
+			pass = 0;
+		else if (acc->soa.type[p] != INSTANCE)
+			pass = packet_cull(pk, &acc->soa, p, m);
+		while (pass)
+		{
+			record(acc, pk, p, __builtin_ctzl(pass));
+			pass &= pass - 1;
+		}
+	}
+}
+
+// ray i, the only one of the packet left in the subtree of node, walks on
+// by itself (see bvh_subtree_hit())
+static void	alone(t_accel *acc, t_packet *pk, int node, int i)
+{
+	if (!bvh_subtree_hit(acc, node, &pk->ray[i], &pk->rec[i]))
+		return ;
+	pk->hit |= 1UL << i;
+	pk->t[i] = pk->rec[i].t;
+}
+
+/* push_children()
+	Pushes both children of an inner node with the rays of mask m, which
+	reached it. Their boxes are tested when they are popped, against the
+	closest hits of that time. The first ray of the mask decides the order,
+	the child it enters first is pushed last so that it is visited first.
+*/
+static void	push_children(t_accel *acc, t_packet *pk, t_packet_trav *tr,
+		unsigned long m)
+{
+	t_real	t[2];
+	int		left;
+	int		i;
+
+	if (tr->sp + 2 > BVH_STACK_SIZE)
+		return ;
+	left = acc->nodes[tr->stack[tr->sp]].left_first;
+	i = __builtin_ctzl(m);
+	t[0] = aabb_hit(&acc->nodes[left].box, pk->ray[i].origin,
+			pk->inv_dir[i], pk->rec[i].t);
+	t[1] = aabb_hit(&acc->nodes[left + 1].box, pk->ray[i].origin,
+			pk->inv_dir[i], pk->rec[i].t);
+	tr->stack[tr->sp] = left + (t[0] <= t[1]);
+	tr->stack[tr->sp + 1] = left + (t[0] > t[1]);
+	tr->mask[tr->sp] = m;
+	tr->mask[tr->sp + 1] = m;
+	tr->sp += 2;
+}
+
+/* packet_walk()
+	Walks the binary BVH with all the rays of the packet at once, front to
+	back for its first rays. At each node popped, the box is tested against
+	the frustum of the tile once, then across the rays that reached it
+	(packet_box()): the node is skipped if none of them crosses it before
+	its closest hit, the rays that do go on to the children or test the
+	primitives of the leaf. When the rays diverge down
+	to a single one, it finishes the subtree alone, without the masks.
+*/
+void	packet_walk(t_accel *acc, t_packet *pk)
+{
+	t_packet_trav	tr;
+	t_bvh_node		*node;
+	unsigned long	m;
+
+	if (acc->node_count == 0)
+		return ;
+	tr.stack[0] = 0;
+	tr.mask[0] = ~0UL >> (PACKET_MAX - pk->n);
+	tr.sp = 1;
+	while (tr.sp-- > 0)
+	{
+		node = &acc->nodes[tr.stack[tr.sp]];
+		m = 0;
+		if (!frustum_box(&pk->fr, &node->box))
+			m = packet_box(pk, &node->box, tr.mask[tr.sp]);
+		if (m == 0)
+			continue ;
+		if ((m & (m - 1)) == 0)
+			alone(acc, pk, tr.stack[tr.sp], __builtin_ctzl(m));
+		else if (node->count == 0)
+			push_children(acc, pk, &tr, m);
+		else
+			hit_leaf(acc, pk, node, m);
+	}
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_compile_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:37:25 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:52:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// primitive i of an accel: its bounded objects first, then its planes
+static t_object	*prim_object(t_accel *acc, int i)
+{
+	if (i < acc->prim_count)
+		return (acc->prims[i]);
+	return (acc->planes[i - acc->prim_count]);
+}
+
+/* prim_compile()
+	The scene compile: copies the objects of an accel, in the order of
+	acc->prims then acc->planes, into flat arrays per object type (see
+	t_prim_soa). The traversals then read the geometry of neighbouring
+	primitives from a few contiguous arrays instead of following two
+	pointers per object (t_object then its shape_data) into the heap
+	blocks the parser left them in. Done after every build that reorders
+	acc->prims, the old arrays are dropped.
+	Sets obj->prim to the index of each object.
+	Return 1 on success, 0 on allocation failure
+*/
+int	prim_compile(t_accel *acc)
+{
+	t_prim_soa	*s;
+	t_object	*obj;
+	int			total;
+	int			i;
+
+	s = &acc->soa;
+	prim_soa_free(s);
+	total = acc->prim_count + acc->plane_count;
+	ft_bzero(s->count, sizeof(s->count));
+	i = -1;
+	while (++i < total)
+		s->count[prim_object(acc, i)->type]++;
+	if (!prim_soa_alloc(s, total))
+		return (0);
+	ft_bzero(s->count, sizeof(s->count));
+	i = -1;
+	while (++i < total)
+	{
+		obj = prim_object(acc, i);
+		obj->prim = i;
+		s->type[i] = obj->type;
+		s->slot[i] = s->count[obj->type]++;
+		prim_pack(s, i, obj);
+	}
+	return (1);
+}
+
+/* prim_repack()
+	The objects in `moved` changed in place (--animate): their compiled
+	copies are brought up to date, found through obj->prim
+*/
+void	prim_repack(t_accel *acc, t_object **moved, int count)
+{
+	int	i;
+
+	i = -1;
+	while (++i < count)
+		prim_pack(&acc->soa, moved[i]->prim, moved[i]);
+}
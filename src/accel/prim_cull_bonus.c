@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_cull_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:29:45 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:45:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* prim_stats()
+	The counters of prim_hit() and of the queries, printed by --bench. Each
+	thread has its own, plain counters no other thread writes to; the
+	threads of a render add theirs to those of the main thread once they
+	are done (see prim_stats_add()).
+	Return the counters of the calling thread
+*/
+t_prim_stats	*prim_stats(void)
+{
+	static __thread t_prim_stats	stats;
+
+	return (&stats);
+}
+
+// adds the counters of another thread to those of the calling thread
+void	prim_stats_add(t_prim_stats *from)
+{
+	t_prim_stats	*to;
+	int				type;
+
+	to = prim_stats();
+	type = -1;
+	while (++type <= INSTANCE)
+	{
+		to->tests[type] += from->tests[type];
+		to->culled[type] += from->culled[type];
+		to->hits[type] += from->hits[type];
+	}
+	to->rays += from->rays;
+	to->shadow_rays += from->shadow_rays;
+}
+
+/* prim_bounds_init()
+	Sets up the bounding sphere of a cylinder or a cone, once, before the
+	scene is rendered (see collect_objects()). It is kept relative to the
+	axis, it stays valid when the object moves: prim_pack() places it.
+	- cylinder: centered on the middle of the axis, through the cap rims
+	- cone: the smallest sphere through the tip and the base rim, centered
+		on the axis at m from the tip, m² = (h - m)² + r², unless the cone
+		is wider than high: then the base disc is the widest part.
+	Both radii are grown a little, the test must never reject a hit.
+*/
+void	prim_bounds_init(t_object *obj)
+{
+	t_cylinder	*cy;
+	t_cone		*co;
+	t_real		r_sq;
+
+	if (obj->type == CYLINDER)
+	{
+		cy = obj->shape_data;
+		cy->bound_mid = cy->height / 2.0;
+		cy->bound_sq = (cy->bound_mid * cy->bound_mid + cy->diameter
+				* cy->diameter / 4.0) * (1.0 + 1e-6);
+	}
+	if (obj->type != CONE)
+		return ;
+	co = obj->shape_data;
+	r_sq = co->height * co->height * (1.0 / co->cos_angle_sq - 1.0);
+	co->bound_mid = fmin((co->height * co->height + r_sq)
+			/ (2.0 * co->height), co->height);
+	co->bound_sq = fmax(co->bound_mid * co->bound_mid, r_sq) * (1.0 + 1e-6);
+}
+
+/* sphere_misses()
+	Whether the ray misses the sphere (center, r²) in [0.001, t_max], with
+	no square root: a, b and c are those of hit_sphere(), b halved.
+	- b² < a * c:	the ray's line passes beside the sphere
+	- c > 0, b > 0:	the ray starts outside and goes away from it
+	- the sphere is entered past t_max, (-b - sqrt(b² - ac)) / a > t_max:
+		-b - a * t_max > sqrt(b² - ac), squared when the left side is > 0
+	Return 1 if nothing inside the sphere can be hit, 0 otherwise
+*/
+static int	sphere_misses(t_point3 center, t_real r_sq, t_ray *ray,
+		t_real t_max)
+{
+	t_vec3	oc;
+	t_real	a;
+	t_real	b;
+	t_real	c;
+	t_real	far;
+
+	oc = vec3_sub(ray->origin, center);
+	a = vec3_length_squared(ray->direction);
+	b = vec3_dot(ray->direction, oc);
+	c = vec3_length_squared(oc) - r_sq;
+	if (b * b < a * c || (c > 0.0 && b > 0.0))
+		return (1);
+	far = -b - a * t_max;
+	return (far > 0.0 && far * far > b * b - a * c);
+}
+
+/* prim_culled()
+	Cheap test before the full one of a cylinder (wall quadratic and two
+	caps) or of a cone (wall quadratic and base cap): does the ray miss its
+	bounding sphere? A sphere is its own bounding sphere: most of them are
+	missed, and are rejected here without their geometry being read.
+	The spheres of all the primitives are in the same arrays, in the order
+	of the primitives (see t_prim_soa). Planes are never rejected.
+	Counts the test.
+	Return 1 if primitive i can't be hit, 0 if it has to be tested
+*/
+int	prim_culled(t_prim_soa *s, int i, t_ray *ray, t_real t_max)
+{
+	int	miss;
+
+	prim_stats()->tests[s->type[i]]++;
+	if (s->type[i] == PLANE)
+		return (0);
+	miss = sphere_misses((t_point3){s->bound[0][i], s->bound[1][i],
+			s->bound[2][i]}, s->bound[3][i], ray, t_max);
+	if (miss)
+		prim_stats()->culled[s->type[i]]++;
+	return (miss);
+}
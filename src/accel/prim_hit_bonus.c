@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_hit_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:37:34 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:35:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the intersection routine of the type of primitive i, on a copy of its
+// compiled geometry, rec->t being the farthest distance to accept
+static int	hit_shape(t_prim_soa *s, int i, t_ray *ray, t_hit_record *rec)
+{
+	t_sphere	sp;
+	t_plane		pl;
+	t_cylinder	cy;
+	t_cone		co;
+
+	if (s->type[i] == SPHERE)
+	{
+		sp = soa_sphere(s, s->slot[i]);
+		return (hit_sphere(&sp, ray, rec->t, rec));
+	}
+	if (s->type[i] == PLANE)
+	{
+		pl = soa_plane(s, s->slot[i]);
+		return (hit_plane(&pl, ray, rec->t, rec));
+	}
+	if (s->type[i] == CYLINDER)
+	{
+		cy = soa_cylinder(s, s->slot[i]);
+		return (hit_cylinder(&cy, ray, rec->t, rec));
+	}
+	co = soa_cone(s, s->slot[i]);
+	return (hit_cone(&co, ray, rec->t, rec));
+}
+
+// records the hit of primitive i if it is closer than rec->t, with its
+// material; the instances are left to prim_hit()
+int	prim_record(t_accel *acc, int i, t_ray *ray, t_hit_record *rec)
+{
+	t_prim_soa		*s;
+	t_hit_record	tmp;
+
+	s = &acc->soa;
+	tmp.t = rec->t;
+	if (!hit_shape(s, i, ray, &tmp))
+		return (0);
+	prim_stats()->hits[s->type[i]]++;
+	material_apply(&s->mat[i], &tmp);
+	*rec = tmp;
+	return (1);
+}
+
+/* prim_hit()
+	Intersects primitive i of an accel, from its compiled arrays
+	Input:
+		*acc:	the accel, compiled (see prim_compile())
+		i:		the primitive, an index into acc->prims, then acc->planes
+		*ray:	the ray to test
+		*rec:	rec->t holds the closest distance found so far, the record
+				is only overwritten by a closer hit
+	Return 1 if the primitive was hit closer than rec->t, 0 otherwise
+
+	An instance is hit through its t_object and brings the material of the
+	group's object it hit along. Cylinders and cones are first tested
+	against their bounding sphere, which rejects most misses for a fraction
+	of the cost of the full test. Tests, rejects and hits are counted per
+	object type (see prim_report()).
+*/
+int	prim_hit(t_accel *acc, int i, t_ray *ray, t_hit_record *rec)
+{
+	if (acc->soa.type[i] == INSTANCE)
+		return (hit_instance(acc->prims[i]->shape_data, ray, rec->t, rec));
+	if (prim_culled(&acc->soa, i, ray, rec->t))
+		return (0);
+	return (prim_record(acc, i, ray, rec));
+}
+
+// the occlusion test of primitive i (not an instance) with the routine of
+// its type (see occlusion_bonus.c), its hit counted; the bounding sphere is
+// left to the caller, as in prim_record()
+int	prim_blocks(t_accel *acc, int i, t_ray *ray, t_real t_max)
+{
+	t_prim_soa	*s;
+	int			hit;
+
+	s = &acc->soa;
+	if (s->type[i] == SPHERE)
+		hit = occlude_sphere((t_sphere []){soa_sphere(s, s->slot[i])}, ray,
+				t_max);
+	else if (s->type[i] == PLANE)
+		hit = occlude_plane((t_plane []){soa_plane(s, s->slot[i])}, ray,
+				t_max);
+	else if (s->type[i] == CYLINDER)
+		hit = occlude_cylinder((t_cylinder []){soa_cylinder(s, s->slot[i])},
+				ray, t_max);
+	else
+		hit = occlude_cone((t_cone []){soa_cone(s, s->slot[i])}, ray, t_max);
+	if (hit)
+		prim_stats()->hits[s->type[i]]++;
+	return (hit);
+}
+
+/* prim_occludes()
+	Occlusion test of primitive i (shadow rays): is it hit closer than
+	t_max? Same bounding sphere test and counters as prim_hit(), but the
+	primitive's own test stops at the first hit in range, and neither the
+	hit point, the normal nor the material are computed.
+	Return 1 if the primitive is hit closer than t_max, 0 otherwise
+*/
+int	prim_occludes(t_accel *acc, int i, t_ray *ray, t_real t_max)
+{
+	if (acc->soa.type[i] == INSTANCE)
+		return (hit_instance(acc->prims[i]->shape_data, ray, t_max, NULL));
+	if (prim_culled(&acc->soa, i, ray, t_max))
+		return (0);
+	return (prim_blocks(acc, i, ray, t_max));
+}
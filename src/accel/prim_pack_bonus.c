@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_pack_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:37:16 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 01:50:09 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// writes a point or a vector into entry k of its x, y and z arrays
+static void	put3(double *arr[3], int k, t_vec3 v)
+{
+	arr[0][k] = v.x;
+	arr[1][k] = v.y;
+	arr[2][k] = v.z;
+}
+
+// the bounding sphere of primitive i, from its center and radius²
+static void	put_bound(t_prim_soa *s, int i, t_point3 center, double r_sq)
+{
+	put3(s->bound, i, center);
+	s->bound[3][i] = r_sq;
+}
+
+static void	pack_cylinder(t_prim_soa *s, int i, t_cylinder *cy)
+{
+	t_point3	c;
+	int			k;
+
+	k = s->slot[i];
+	put3(s->cy.center, k, cy->center);
+	put3(s->cy.axis, k, cy->axis);
+	s->cy.diameter[k] = cy->diameter;
+	s->cy.height[k] = cy->height;
+	s->cy.radius_sq[k] = cy->radius_sq;
+	put3(s->cy.top, k, cy->top);
+	c = vec3_add(cy->center, vec3_mul(cy->axis, cy->bound_mid));
+	put_bound(s, i, c, cy->bound_sq);
+	put3(s->cy.bound, k, c);
+	s->cy.bound[3][k] = cy->bound_sq;
+}
+
+static void	pack_cone(t_prim_soa *s, int i, t_cone *co)
+{
+	t_point3	c;
+	int			k;
+
+	k = s->slot[i];
+	put3(s->co.tip, k, co->tip);
+	put3(s->co.axis, k, co->axis);
+	s->co.height[k] = co->height;
+	s->co.cos_angle_sq[k] = co->cos_angle_sq;
+	s->co.inv_cos_sq[k] = co->inv_cos_sq;
+	put3(s->co.base, k, co->base);
+	s->co.cap_r_sq[k] = co->cap_r_sq;
+	c = vec3_add(co->tip, vec3_mul(co->axis, co->bound_mid));
+	put_bound(s, i, c, co->bound_sq);
+	put3(s->co.bound, k, c);
+	s->co.bound[3][k] = co->bound_sq;
+}
+
+/* prim_pack()
+	Copies an object into primitive i of the compiled arrays: its geometry
+	into the arrays of its type, at the entry s->slot[i], its bounding
+	sphere (a sphere's own, grown like the others, see prim_bounds_init())
+	and its material. An instance has nothing to copy, it is hit through
+	its t_object, and neither has a plane a bounding sphere. The derived
+	quantities of the shape (radius², cap centers...) are computed first,
+	the object may have moved since the last time (see shape_prepare()).
+*/
+void	prim_pack(t_prim_soa *s, int i, t_object *obj)
+{
+	t_sphere	*sp;
+	t_plane		*pl;
+
+	put_bound(s, i, (t_point3){0, 0, 0}, 0.0);
+	shape_prepare(obj);
+	if (obj->type == SPHERE)
+	{
+		sp = obj->shape_data;
+		put3(s->sp.center, s->slot[i], sp->center);
+		s->sp.radius[s->slot[i]] = sp->radius;
+		s->sp.radius_sq[s->slot[i]] = sp->radius_sq;
+		put_bound(s, i, sp->center, sp->radius_sq * (1.0 + 1e-6));
+	}
+	else if (obj->type == PLANE)
+	{
+		pl = obj->shape_data;
+		put3(s->pl.point, s->slot[i], pl->point);
+		put3(s->pl.normal, s->slot[i], pl->normal);
+	}
+	else if (obj->type == CYLINDER)
+		pack_cylinder(s, i, obj->shape_data);
+	else if (obj->type == CONE)
+		pack_cone(s, i, obj->shape_data);
+	material_pack(&s->mat[i], obj);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_range_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:18:10 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the number of spheres, cylinders or cones of the same type from primitive
+// i on, before end: a run the kernels test at once, 0 if shorter than 2.
+// prim_compile() gives the primitives of a type their entries in order, the
+// entries of a run follow each other.
+static int	kernel_run(t_prim_soa *s, int i, int end)
+{
+	int	n;
+
+	n = 1;
+	while (i + n < end && s->type[i + n] == s->type[i])
+		n++;
+	if (n < 2 || s->simd == SIMD_NONE || s->type[i] == PLANE
+		|| s->type[i] == INSTANCE)
+		return (0);
+	return (n);
+}
+
+/* hit_run()
+	The closest of the run[1] primitives from primitive run[0], all of the
+	type run[2], found by the kernels, then recorded by prim_record() as
+	prim_hit() does. Every primitive of the run is counted as tested, those
+	that are not the closest one as rejected.
+	Return 1 if one of them is hit closer than rec->t, 0 otherwise
+*/
+static int	hit_run(t_accel *acc, int run[3], t_ray *ray, t_hit_record *rec)
+{
+	double	t;
+	int		first;
+	int		k;
+
+	first = acc->soa.slot[run[0]];
+	t = rec->t;
+	k = kernel_closest(&acc->soa, (int [3]){first, run[1], run[2]}, ray, &t);
+	prim_stats()->tests[run[2]] += run[1];
+	prim_stats()->culled[run[2]] += run[1] - (k >= 0);
+	if (k < 0)
+		return (0);
+	return (prim_record(acc, run[0] + k - first, ray, rec));
+}
+
+// occlusion version of hit_run()
+static int	occludes_run(t_accel *acc, int run[3], t_ray *ray, t_real t_max)
+{
+	int	hit;
+
+	hit = kernel_any(&acc->soa, (int [3]){acc->soa.slot[run[0]], run[1],
+			run[2]}, ray, t_max);
+	prim_stats()->tests[run[2]] += run[1];
+	prim_stats()->culled[run[2]] += run[1] - hit;
+	prim_stats()->hits[run[2]] += hit;
+	return (hit);
+}
+
+/* prim_hit_range()
+	prim_hit() on the primitives [range[0], range[1]) of an accel (a leaf,
+	the planes, the whole list): the runs of spheres, of cylinders or of
+	cones that follow each other in the compiled arrays go through the SIMD
+	kernels (see kernel_closest()), the other primitives one at a time.
+	Return 1 if a closer hit was found, 0 otherwise
+*/
+int	prim_hit_range(t_accel *acc, int range[2], t_ray *ray,
+		t_hit_record *rec)
+{
+	int	run[3];
+	int	hit;
+
+	hit = 0;
+	run[0] = range[0];
+	while (run[0] < range[1])
+	{
+		run[1] = kernel_run(&acc->soa, run[0], range[1]);
+		run[2] = acc->soa.type[run[0]];
+		if (run[1] > 1 && hit_run(acc, run, ray, rec))
+			hit = 1;
+		if (run[1] < 2)
+		{
+			run[1] = 1;
+			if (prim_hit(acc, run[0], ray, rec))
+				hit = 1;
+		}
+		run[0] += run[1];
+	}
+	return (hit);
+}
+
+// prim_occludes() on the primitives [range[0], range[1]), returning as soon
+// as one of them is hit closer than t_max
+int	prim_occludes_range(t_accel *acc, int range[2], t_ray *ray,
+		t_real t_max)
+{
+	int	run[3];
+
+	run[0] = range[0];
+	while (run[0] < range[1])
+	{
+		run[1] = kernel_run(&acc->soa, run[0], range[1]);
+		run[2] = acc->soa.type[run[0]];
+		if (run[1] > 1 && occludes_run(acc, run, ray, t_max))
+			return (1);
+		if (run[1] < 2)
+		{
+			run[1] = 1;
+			if (prim_occludes(acc, run[0], ray, t_max))
+				return (1);
+		}
+		run[0] += run[1];
+	}
+	return (0);
+}
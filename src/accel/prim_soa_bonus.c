@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_soa_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:37:00 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 01:50:09 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// points each array of a type (its struct of `size` bytes holds nothing
+// but double pointers) to its n entries in the block, one after the other
+static double	*carve(void *arrays, long size, int n, double *p)
+{
+	double	**a;
+	long	fields;
+
+	a = arrays;
+	fields = size / sizeof(double *);
+	while (fields-- > 0)
+	{
+		*a++ = p;
+		p += n;
+	}
+	return (p);
+}
+
+/* prim_soa_carve()
+	Splits the block of doubles into the bounding spheres of the s->total
+	primitives, then the arrays of each type, sized by s->count[]: the
+	spheres', the planes', the cylinders' and the cones'. Done again after
+	a cache load, the block has moved.
+*/
+void	prim_soa_carve(t_prim_soa *s)
+{
+	double	*p;
+
+	p = carve(s->bound, sizeof(s->bound), s->total, s->block);
+	p = carve(&s->sp, sizeof(t_sphere_soa), s->count[SPHERE], p);
+	p = carve(&s->pl, sizeof(t_plane_soa), s->count[PLANE], p);
+	p = carve(&s->cy, sizeof(t_cylinder_soa), s->count[CYLINDER], p);
+	carve(&s->co, sizeof(t_cone_soa), s->count[CONE], p);
+}
+
+// doubles in the block for s->total primitives, s->count[] of each type
+long	prim_soa_doubles(t_prim_soa *s)
+{
+	long	n;
+
+	n = (long)s->total * sizeof(s->bound);
+	n += (long)s->count[SPHERE] * sizeof(t_sphere_soa);
+	n += (long)s->count[PLANE] * sizeof(t_plane_soa);
+	n += (long)s->count[CYLINDER] * sizeof(t_cylinder_soa);
+	n += (long)s->count[CONE] * sizeof(t_cone_soa);
+	return (n / sizeof(double *));
+}
+
+/* prim_soa_alloc()
+	Allocates the arrays of `total` primitives, s->count[] already holding
+	how many there are of each type, and picks the kernels the CPU can
+	run
+	Return 1 on success, 0 on allocation failure (all freed)
+*/
+int	prim_soa_alloc(t_prim_soa *s, int total)
+{
+	s->total = total;
+	s->type = malloc(sizeof(unsigned char) * (total + 1));
+	s->slot = malloc(sizeof(int) * (total + 1));
+	s->mat = malloc(sizeof(t_material) * (total + 1));
+	s->block = malloc(sizeof(double) * (prim_soa_doubles(s) + 1));
+	if (!s->type || !s->slot || !s->mat || !s->block)
+		return (prim_soa_free(s), 0);
+	prim_soa_carve(s);
+	s->simd = kernel_simd_level();
+	return (1);
+}
+
+void	prim_soa_free(t_prim_soa *s)
+{
+	free(s->type);
+	free(s->slot);
+	free(s->mat);
+	free(s->block);
+	s->type = NULL;
+	s->slot = NULL;
+	s->mat = NULL;
+	s->block = NULL;
+	s->total = 0;
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_unpack_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:37:16 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 01:10:53 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// reads entry k of the x, y and z arrays of a point or a vector
+static t_vec3	get3(double *arr[3], int k)
+{
+	return ((t_vec3){arr[0][k], arr[1][k], arr[2][k]});
+}
+
+// the sphere at entry k of the compiled arrays, as hit_sphere() takes it
+t_sphere	soa_sphere(t_prim_soa *s, int k)
+{
+	return ((t_sphere){.center = get3(s->sp.center, k),
+		.radius = s->sp.radius[k], .radius_sq = s->sp.radius_sq[k]});
+}
+
+t_plane	soa_plane(t_prim_soa *s, int k)
+{
+	return ((t_plane){.point = get3(s->pl.point, k),
+		.normal = get3(s->pl.normal, k)});
+}
+
+// the cylinder at entry k, its bounding sphere is left out: prim_culled()
+// tests the one of the arrays
+t_cylinder	soa_cylinder(t_prim_soa *s, int k)
+{
+	return ((t_cylinder){.center = get3(s->cy.center, k),
+		.axis = get3(s->cy.axis, k), .diameter = s->cy.diameter[k],
+		.height = s->cy.height[k], .radius_sq = s->cy.radius_sq[k],
+		.top = get3(s->cy.top, k)});
+}
+
+t_cone	soa_cone(t_prim_soa *s, int k)
+{
+	return ((t_cone){.tip = get3(s->co.tip, k), .axis = get3(s->co.axis, k),
+		.height = s->co.height[k], .cos_angle_sq = s->co.cos_angle_sq[k],
+		.inv_cos_sq = s->co.inv_cos_sq[k], .base = get3(s->co.base, k),
+		.cap_r_sq = s->co.cap_r_sq[k]});
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   qbvh_build_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:13:40 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:19:20 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// closest lattice point of an offset d from the min of the parent box,
+// below it for a min coordinate, above it for a max one (`up`)
+static int	lattice(t_accel *acc, double d, double step, int up)
+{
+	double	q;
+
+	if (step <= 0.0)
+		return (0);
+	q = floor(d / step);
+	if (up)
+		q = ceil(d / step);
+	return (fmax(0.0, fmin(q, (1 << acc->qbits) - 1)));
+}
+
+/* conservative()
+	Moves the min coordinates of child i down and its max ones up until the
+	decoded box contains the exact one, b[1], whatever the rounding of the
+	decoding. The exact box lies in the decoded box of the node, b[0], so
+	the lattice points 0 and 2^bits - 1 always do.
+*/
+static void	conservative(t_accel *acc, t_qbvh_node *qn, int i, t_aabb b[2])
+{
+	t_aabb	d;
+	int		k;
+	int		q;
+
+	k = -1;
+	while (++k < 6)
+	{
+		d = qbvh_child_box(acc, qn, &b[0], i);
+		q = qbvh_get(acc, qn, i * 6 + k);
+		while (k < 3 && q > 0 && vec3_axis(d.min, k) > vec3_axis(b[1].min, k))
+		{
+			qbvh_set(acc, qn, i * 6 + k, --q);
+			d = qbvh_child_box(acc, qn, &b[0], i);
+		}
+		while (k >= 3 && q < (1 << acc->qbits) - 1
+			&& vec3_axis(d.max, k - 3) < vec3_axis(b[1].max, k - 3))
+		{
+			qbvh_set(acc, qn, i * 6 + k, ++q);
+			d = qbvh_child_box(acc, qn, &b[0], i);
+		}
+	}
+}
+
+/* quantize_child()
+	Stores the exact box b[1] as child i of a node whose decoded box is b[0]
+*/
+static void	quantize_child(t_accel *acc, t_qbvh_node *qn, int i, t_aabb b[2])
+{
+	double	step;
+	double	v;
+	int		a;
+	int		k;
+
+	k = -1;
+	while (++k < 6)
+	{
+		a = k % 3;
+		step = vec3_axis(vec3_sub(b[0].max, b[0].min), a) * (1.0 + 1e-9)
+			/ ((1 << acc->qbits) - 1);
+		v = vec3_axis(b[1].min, a);
+		if (k >= 3)
+			v = vec3_axis(b[1].max, a);
+		qbvh_set(acc, qn, i * 6 + k,
+			lattice(acc, v - vec3_axis(b[0].min, a), step, k >= 3));
+	}
+	conservative(acc, qn, i, b);
+}
+
+/* quantize_node()
+	Creates the quantized node `qi` of the binary inner node `bin`, whose
+	decoded box is *box, then those of its inner children, each one against
+	the decoded box of its parent
+*/
+static void	quantize_node(t_accel *acc, int bin, t_aabb *box, int qi)
+{
+	t_bvh_node	*child;
+	t_qbvh_node	*qn;
+	t_aabb		b[2];
+	int			i;
+
+	qn = qbvh_node(acc, qi);
+	i = -1;
+	while (++i < 2)
+	{
+		child = &acc->nodes[acc->nodes[bin].left_first + i];
+		qn->child[i] = child->left_first;
+		qn->count[i] = child->count;
+		b[0] = *box;
+		b[1] = child->box;
+		quantize_child(acc, qn, i, b);
+		if (child->count != 0)
+			continue ;
+		b[1] = qbvh_child_box(acc, qn, box, i);
+		qn->child[i] = acc->qnode_count++;
+		quantize_node(acc, acc->nodes[bin].left_first + i, &b[1],
+			qn->child[i]);
+	}
+}
+
+/* qbvh_build()
+	Quantizes the binary BVH (already built) with `bits` bits per
+	coordinate, then frees it: one quantized node per binary inner node.
+	A tree that is a single leaf gets one node with a single child.
+	Return 1 on success, 0 on allocation failure
+*/
+int	qbvh_build(t_accel *acc, int bits)
+{
+	t_aabb	b[2];
+
+	acc->qbits = bits;
+	acc->qnode_count = 0;
+	if (acc->node_count == 0)
+		return (1);
+	acc->qnodes = malloc(qbvh_node_size(bits) * max(acc->node_count / 2, 1));
+	if (!acc->qnodes)
+		return (0);
+	acc->qroot = acc->nodes[0].box;
+	acc->qnode_count = 1;
+	if (acc->nodes[0].count == 0)
+		quantize_node(acc, 0, &acc->qroot, 0);
+	else
+	{
+		*qbvh_node(acc, 0) = (t_qbvh_node){{acc->nodes[0].left_first, 0},
+		{acc->nodes[0].count, -1}};
+		b[0] = acc->qroot;
+		b[1] = acc->qroot;
+		quantize_child(acc, qbvh_node(acc, 0), 0, b);
+	}
+	free(acc->nodes);
+	acc->nodes = NULL;
+	acc->node_count = 0;
+	return (1);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   qbvh_node_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:13:00 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:19:20 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// bytes of a node: the links, then 12 coordinates of `bits` bits
+int	qbvh_node_size(int bits)
+{
+	return (sizeof(t_qbvh_node) + 12 * (bits / 8));
+}
+
+t_qbvh_node	*qbvh_node(t_accel *acc, int index)
+{
+	return ((t_qbvh_node *)(acc->qnodes
+		+ (long)index * qbvh_node_size(acc->qbits)));
+}
+
+// quantized coordinate k of a node (see t_qbvh_node)
+int	qbvh_get(t_accel *acc, t_qbvh_node *node, int k)
+{
+	if (acc->qbits == 8)
+		return (node->q[k]);
+	return (((unsigned short *)node->q)[k]);
+}
+
+void	qbvh_set(t_accel *acc, t_qbvh_node *node, int k, int v)
+{
+	if (acc->qbits == 8)
+		node->q[k] = v;
+	else
+		((unsigned short *)node->q)[k] = v;
+}
+
+/* qbvh_child_box()
+	Decodes the box of child i of a node, given the decoded box of the node
+	itself: coordinate = box min + q * step, the lattice spanning the box in
+	2^bits - 1 steps. The step is made a hair larger, so that the last
+	lattice point is past the box max despite the rounding.
+	The build decodes the boxes with this same function: it checks that
+	they contain the exact ones.
+*/
+t_aabb	qbvh_child_box(t_accel *acc, t_qbvh_node *node, t_aabb *box, int i)
+{
+	unsigned short	q[6];
+	double			scale;
+	t_aabb			c;
+	int				k;
+
+	k = -1;
+	while (acc->qbits == 8 && ++k < 6)
+		q[k] = node->q[i * 6 + k];
+	while (acc->qbits == 16 && ++k < 6)
+		q[k] = ((unsigned short *)node->q)[i * 6 + k];
+	scale = (1.0 + 1e-9) / ((1 << acc->qbits) - 1);
+	c.min.x = box->min.x + q[0] * ((box->max.x - box->min.x) * scale);
+	c.min.y = box->min.y + q[1] * ((box->max.y - box->min.y) * scale);
+	c.min.z = box->min.z + q[2] * ((box->max.z - box->min.z) * scale);
+	c.max.x = box->min.x + q[3] * ((box->max.x - box->min.x) * scale);
+	c.max.y = box->min.y + q[4] * ((box->max.y - box->min.y) * scale);
+	c.max.z = box->min.z + q[5] * ((box->max.z - box->min.z) * scale);
+	return (c);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   qbvh_traverse_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:14:05 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// prepares the traversal of one ray: the root node, with its exact box, is
+// on the stack if the ray hits that box
+static void	qtrav_init(t_accel *acc, t_qbvh_trav *tr, t_ray *ray,
+		t_real t_max)
+{
+	t_real	t_root;
+
+	tr->ray = ray;
+	tr->inv_dir.x = 1.0 / ray->direction.x;
+	tr->inv_dir.y = 1.0 / ray->direction.y;
+	tr->inv_dir.z = 1.0 / ray->direction.z;
+	tr->t_max = t_max;
+	tr->sp = 0;
+	if (acc->qnode_count == 0)
+		return ;
+	t_root = aabb_hit(&acc->qroot, ray->origin, tr->inv_dir, t_max);
+	if (t_root == INFINITY)
+		return ;
+	tr->stack[0] = 0;
+	tr->dist[0] = t_root;
+	tr->box[0] = acc->qroot;
+	tr->sp = 1;
+}
+
+/* hit_prims()
+	Intersects the primitives of a leaf
+	Input:
+		leaf:	its first primitive and their count
+		*rec:	closest-hit: the record is overwritten by every closer hit
+				any-hit (NULL): the first hit ends the search
+	Return 1 if anything closer than tr->t_max was hit, 0 otherwise
+*/
+static int	hit_prims(t_accel *acc, int leaf[2], t_qbvh_trav *tr,
+		t_hit_record *rec)
+{
+	t_hit_record	temp_rec;
+	int				range[2];
+
+	range[0] = leaf[0];
+	range[1] = leaf[0] + leaf[1];
+	if (!rec)
+		return (prim_occludes_range(acc, range, tr->ray, tr->t_max));
+	temp_rec.t = tr->t_max;
+	if (!prim_hit_range(acc, range, tr->ray, &temp_rec))
+		return (0);
+	*rec = temp_rec;
+	tr->t_max = temp_rec.t;
+	return (1);
+}
+
+// pushes the inner children hit by the ray (t[i] not INFINITY) with their
+// decoded boxes, the closer one last so that it is visited first
+static void	push_children(t_qbvh_trav *tr, t_qbvh_node *qn, t_real t[2],
+		t_aabb box[2])
+{
+	int	near;
+	int	k;
+	int	i;
+
+	near = (t[1] < t[0]);
+	k = -1;
+	while (++k < 2)
+	{
+		i = near ^ (k == 0);
+		if (t[i] == INFINITY || qn->count[i] != 0 || tr->sp >= BVH_STACK_SIZE)
+			continue ;
+		tr->stack[tr->sp] = qn->child[i];
+		tr->dist[tr->sp] = t[i];
+		tr->box[tr->sp] = box[i];
+		tr->sp++;
+	}
+}
+
+/* visit()
+	Visits the node just popped (at tr->sp): decodes the boxes of its
+	children from its own, tests them, intersects the leaves hit right away
+	and pushes the inner children hit. Only child 1 can be missing.
+	Return 1 if a leaf had a hit closer than tr->t_max, 0 otherwise
+*/
+static int	visit(t_accel *acc, t_qbvh_trav *tr, t_hit_record *rec)
+{
+	t_qbvh_node	*qn;
+	t_aabb		box[2];
+	t_real		t[2];
+	int			hit;
+	int			i;
+
+	qn = qbvh_node(acc, tr->stack[tr->sp]);
+	hit = 0;
+	t[1] = INFINITY;
+	i = -1;
+	while (++i < 2 && qn->count[i] >= 0)
+	{
+		box[i] = qbvh_child_box(acc, qn, &tr->box[tr->sp], i);
+		t[i] = aabb_hit(&box[i], tr->ray->origin, tr->inv_dir, tr->t_max);
+		if (t[i] == INFINITY || qn->count[i] == 0)
+			continue ;
+		hit |= hit_prims(acc, (int [2]){qn->child[i], qn->count[i]}, tr, rec);
+		if (hit && !rec)
+			return (1);
+	}
+	push_children(tr, qn, t, box);
+	return (hit);
+}
+
+/* qbvh_hit()
+	Walks the quantized BVH front to back, like bvh_closest_hit()
+	Input:
+		t_max:	the closest distance found so far (e.g. by the planes)
+		*rec:	overwritten by every closer hit, NULL for an occlusion
+				query: the first primitive hit closer than t_max ends it
+	Return 1 if a hit closer than t_max was found in the tree, 0 otherwise
+*/
+int	qbvh_hit(t_accel *acc, t_ray *ray, t_real t_max, t_hit_record *rec)
+{
+	t_qbvh_trav	tr;
+	int			hit;
+
+	qtrav_init(acc, &tr, ray, t_max);
+	hit = 0;
+	while (tr.sp-- > 0)
+	{
+		if (tr.dist[tr.sp] >= tr.t_max || !visit(acc, &tr, rec))
+			continue ;
+		if (!rec)
+			return (1);
+		hit = 1;
+	}
+	return (hit);
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   quadric_avx512_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:34:56 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:32:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+// dot_avx() on 8 lanes; like all the AVX-512F kernels, compiled without
+// fused multiply-adds (see terms_avx512())
+__attribute__((target("avx512f")))
+__m512d	dot_avx512(__m512d u[3], __m512d v[3])
+{
+	return (_mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(u[0], v[0]),
+				_mm512_mul_pd(u[1], v[1])), _mm512_mul_pd(u[2], v[2])));
+}
+
+// bound_avx() of the entries k .. k + 7, *pass being a mask register
+__attribute__((target("avx512f")))
+void	bound_avx512(double *bound[4], int k, t_kernel_ray *r, __mmask8 *pass)
+{
+	__m512d	oc[3];
+	__m512d	d[3];
+	__m512d	b;
+	__m512d	c;
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm512_sub_pd(_mm512_set1_pd(r->o[i]),
+				_mm512_loadu_pd(bound[i] + k));
+		d[i] = _mm512_set1_pd(r->d[i]);
+	}
+	b = dot_avx512(d, oc);
+	c = _mm512_sub_pd(dot_avx512(oc, oc), _mm512_loadu_pd(bound[3] + k));
+	*pass = ~(_mm512_cmp_pd_mask(c, _mm512_setzero_pd(), _CMP_GT_OQ)
+			& _mm512_cmp_pd_mask(b, _mm512_setzero_pd(), _CMP_GT_OQ))
+		& _mm512_cmp_pd_mask(_mm512_mul_pd(b, b), _mm512_mul_pd(
+				_mm512_set1_pd(r->dd), c), _CMP_NLT_UQ);
+}
+
+// cap_avx() on 8 discs
+__attribute__((target("avx512f")))
+void	cap_avx512(__m512d cap[8], t_kernel_ray *r, __m512d *t)
+{
+	__m512d		q[3];
+	__mmask8	ok;
+	int			i;
+
+	i = -1;
+	while (++i < 3)
+		q[i] = _mm512_sub_pd(cap[i], _mm512_set1_pd(r->o[i]));
+	*t = _mm512_div_pd(dot_avx512(q, cap + 3), cap[7]);
+	i = -1;
+	while (++i < 3)
+		q[i] = _mm512_sub_pd(_mm512_add_pd(_mm512_set1_pd(r->o[i]),
+					_mm512_mul_pd(_mm512_set1_pd(r->d[i]), *t)), cap[i]);
+	ok = _mm512_cmp_pd_mask(_mm512_abs_pd(cap[7]), _mm512_set1_pd(PARALLEL_EPS),
+			_CMP_NLT_UQ) & _mm512_cmp_pd_mask(*t, _mm512_set1_pd(HIT_EPS),
+			_CMP_NLE_UQ);
+	ok &= _mm512_cmp_pd_mask(dot_avx512(q, q), cap[6], _CMP_LE_OQ);
+	*t = _mm512_mask_blend_pd(ok, _mm512_set1_pd(INFINITY), *t);
+}
+
+// the distances to the cylinders or the cones k .. k + 7, by the run's type
+__attribute__((target("avx512f")))
+static void	root_avx512(t_prim_soa *s, int k, t_kernel_ray *r, __m512d *t)
+{
+	if (r->type == CYLINDER)
+		cylinder_avx512(&s->cy, k, r, t);
+	else
+		cone_avx512(&s->co, k, r, t);
+}
+
+/* quadrics_avx512()
+	quadrics_avx() 8 cylinders or cones at a time, with AVX-512F, the
+	blocks being handled as in spheres_avx512().
+	Return the entry, -1 if none, *t being set to its distance
+*/
+__attribute__((target("avx512f")))
+int	quadrics_avx512(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	__m512d		best;
+	__m512d		best_k;
+	__m512d		root;
+	double		lane[2][8];
+	int			k;
+
+	best = _mm512_set1_pd(*t);
+	best_k = _mm512_set1_pd(-1);
+	k = blk[0];
+	while (k < blk[0] + blk[1] && !(r->any && _mm512_cmp_pd_mask(best_k,
+				_mm512_setzero_pd(), _CMP_GE_OQ)))
+	{
+		root_avx512(s, k, r, &root);
+		best_k = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(root, best,
+					_CMP_LT_OQ), best_k, _mm512_add_pd(_mm512_set1_pd(k),
+					_mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0)));
+		best = _mm512_min_pd(root, best);
+		k += 8;
+	}
+	_mm512_storeu_pd(lane[0], best);
+	_mm512_storeu_pd(lane[1], best_k);
+	_mm256_zeroupper();
+	return (kernel_pick(lane, 8, t));
+}
+#endif
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   quadric_avx_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:33:33 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_simd.h"
+#ifdef SIMD_KERNELS
+
+// u · v on 4 lanes, with the operations of vec3_dot() in the same order
+__attribute__((target("avx")))
+__m256d	dot_avx(__m256d u[3], __m256d v[3])
+{
+	return (_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(u[0], v[0]),
+				_mm256_mul_pd(u[1], v[1])), _mm256_mul_pd(u[2], v[2])));
+}
+
+/* bound_avx()
+	kernel_bound() on the bounding spheres of the entries k .. k + 3.
+	*pass is set to the mask of the lanes whose primitive has to be tested
+*/
+__attribute__((target("avx")))
+void	bound_avx(double *bound[4], int k, t_kernel_ray *r, __m256d *pass)
+{
+	__m256d	oc[3];
+	__m256d	d[3];
+	__m256d	b;
+	__m256d	c;
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		oc[i] = _mm256_sub_pd(_mm256_set1_pd(r->o[i]),
+				_mm256_loadu_pd(bound[i] + k));
+		d[i] = _mm256_set1_pd(r->d[i]);
+	}
+	b = dot_avx(d, oc);
+	c = _mm256_sub_pd(dot_avx(oc, oc), _mm256_loadu_pd(bound[3] + k));
+	*pass = _mm256_andnot_pd(_mm256_and_pd(_mm256_cmp_pd(c,
+					_mm256_setzero_pd(), _CMP_GT_OQ), _mm256_cmp_pd(b,
+					_mm256_setzero_pd(), _CMP_GT_OQ)), _mm256_cmp_pd(
+				_mm256_mul_pd(b, b), _mm256_mul_pd(_mm256_set1_pd(r->dd), c),
+				_CMP_NLT_UQ));
+}
+
+/* cap_avx()
+	kernel_cap() on 4 discs: cap[] holds their centers (x, y, z), their
+	axes (x, y, z), their radii² and d · axis, which the walls computed.
+	The comparisons are the negations of those of kernel_cap() (a NaN
+	passes them), a NaN distance then fails the test of the radius.
+	*t is set to the distances, INFINITY in the lanes that miss their disc
+*/
+__attribute__((target("avx")))
+void	cap_avx(__m256d cap[8], t_kernel_ray *r, __m256d *t)
+{
+	__m256d	q[3];
+	__m256d	ok;
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		q[i] = _mm256_sub_pd(cap[i], _mm256_set1_pd(r->o[i]));
+	*t = _mm256_div_pd(dot_avx(q, cap + 3), cap[7]);
+	i = -1;
+	while (++i < 3)
+		q[i] = _mm256_sub_pd(_mm256_add_pd(_mm256_set1_pd(r->o[i]),
+					_mm256_mul_pd(_mm256_set1_pd(r->d[i]), *t)), cap[i]);
+	ok = _mm256_and_pd(_mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0),
+					cap[7]), _mm256_set1_pd(PARALLEL_EPS), _CMP_NLT_UQ),
+			_mm256_cmp_pd(*t, _mm256_set1_pd(HIT_EPS), _CMP_NLE_UQ));
+	ok = _mm256_and_pd(ok, _mm256_cmp_pd(dot_avx(q, q), cap[6], _CMP_LE_OQ));
+	*t = _mm256_blendv_pd(_mm256_set1_pd(INFINITY), *t, ok);
+}
+
+// the distances to the cylinders or the cones k .. k + 3, by the run's type
+__attribute__((target("avx")))
+static void	root_avx(t_prim_soa *s, int k, t_kernel_ray *r, __m256d *t)
+{
+	if (r->type == CYLINDER)
+		cylinder_avx(&s->cy, k, r, t);
+	else
+		cone_avx(&s->co, k, r, t);
+}
+
+/* quadrics_avx()
+	kernel_scalar() 4 cylinders or cones at a time, with AVX, the blocks
+	being handled as in spheres_avx(). Each lane finds the distance
+	cylinder_root() or cone_root() finds, with the same operations in the
+	same order: the kernels match the scalar routines exactly.
+	Return the entry, -1 if none, *t being set to its distance
+*/
+__attribute__((target("avx")))
+int	quadrics_avx(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	__m256d	best;
+	__m256d	best_k;
+	__m256d	root;
+	double	lane[2][8];
+	int		k;
+
+	best = _mm256_set1_pd(*t);
+	best_k = _mm256_set1_pd(-1);
+	k = blk[0];
+	while (k < blk[0] + blk[1] && !(r->any && _mm256_movemask_pd(
+				_mm256_cmp_pd(best_k, _mm256_setzero_pd(), _CMP_GE_OQ))))
+	{
+		root_avx(s, k, r, &root);
+		best_k = _mm256_blendv_pd(best_k, _mm256_set_pd(k + 3, k + 2, k + 1,
+					k), _mm256_cmp_pd(root, best, _CMP_LT_OQ));
+		best = _mm256_min_pd(root, best);
+		k += 4;
+	}
+	_mm256_storeu_pd(lane[0], best);
+	_mm256_storeu_pd(lane[1], best_k);
+	_mm256_zeroupper();
+	return (kernel_pick(lane, 4, t));
+}
+#endif
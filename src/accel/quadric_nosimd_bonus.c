@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   quadric_nosimd_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:35:36 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifndef SIMD_KERNELS
+
+// other CPUs and the float build: no SIMD cylinder or cone kernel either, see
+// sphere_nosimd_bonus.c
+int	quadrics_avx(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	return (kernel_scalar(s, blk, r, t));
+}
+
+int	quadrics_avx512(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	return (kernel_scalar(s, blk, r, t));
+}
+#endif
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_avx512_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:16:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:32:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifdef SIMD_KERNELS
+# include <immintrin.h>
+
+/* terms_avx512()
+	terms_sse() for the 8 spheres k .. k + 7, with AVX-512F. AVX-512F has
+	fused multiply-adds, which round once instead of twice: the compiler
+	must not fuse the products and sums (-ffp-contract=off, see the
+	Makefile), the distances would then differ from those of hit_sphere()
+	in the last bits.
+*/
+__attribute__((target("avx512f")))
+static void	terms_avx512(t_sphere_soa *sp, int k, t_kernel_ray *r,
+		__m512d term[2])
+{
+	__m512d	oc[3];
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		oc[i] = _mm512_sub_pd(_mm512_set1_pd(r->o[i]),
+				_mm512_loadu_pd(sp->center[i] + k));
+	term[0] = _mm512_mul_pd(_mm512_set1_pd(2), _mm512_add_pd(_mm512_add_pd(
+					_mm512_mul_pd(_mm512_set1_pd(r->d[0]), oc[0]),
+					_mm512_mul_pd(_mm512_set1_pd(r->d[1]), oc[1])),
+				_mm512_mul_pd(_mm512_set1_pd(r->d[2]), oc[2])));
+	term[1] = _mm512_sub_pd(_mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(oc[0],
+						oc[0]), _mm512_mul_pd(oc[1], oc[1])),
+				_mm512_mul_pd(oc[2], oc[2])), _mm512_loadu_pd(sp->radius_sq
+				+ k));
+	term[1] = _mm512_sub_pd(_mm512_mul_pd(term[0], term[0]),
+			_mm512_mul_pd(_mm512_set1_pd(r->four_a), term[1]));
+}
+
+// root_sse() for the 8 spheres k .. k + 7
+__attribute__((target("avx512f")))
+static __m512d	root_avx512(t_sphere_soa *sp, int k, t_kernel_ray *r)
+{
+	__m512d	term[2];
+	__m512d	nb;
+	__m512d	sq;
+	__m512d	t;
+
+	terms_avx512(sp, k, r, term);
+	nb = _mm512_sub_pd(_mm512_setzero_pd(), term[0]);
+	sq = _mm512_sqrt_pd(term[1]);
+	t = _mm512_div_pd(_mm512_sub_pd(nb, sq), _mm512_set1_pd(r->two_a));
+	t = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(t, _mm512_set1_pd(HIT_EPS),
+				_CMP_GT_OQ), _mm512_div_pd(_mm512_add_pd(nb, sq),
+				_mm512_set1_pd(r->two_a)), t);
+	return (_mm512_mask_blend_pd(_mm512_cmp_pd_mask(t, _mm512_set1_pd(HIT_EPS),
+				_CMP_GT_OQ) & _mm512_cmp_pd_mask(term[1], _mm512_setzero_pd(),
+				_CMP_GE_OQ), _mm512_set1_pd(INFINITY), t));
+}
+
+/* spheres_avx512()
+	spheres_sse() 8 spheres at a time, with AVX-512F. Only called if the
+	CPU supports it (see kernel_simd_level()), the upper halves of the
+	registers are cleared before returning.
+*/
+__attribute__((target("avx512f")))
+int	spheres_avx512(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	__m512d		best;
+	__m512d		best_k;
+	__m512d		root;
+	double		lane[2][8];
+	int			k;
+
+	best = _mm512_set1_pd(*t);
+	best_k = _mm512_set1_pd(-1);
+	k = blk[0];
+	while (k < blk[0] + blk[1] && !(r->any && _mm512_cmp_pd_mask(best_k,
+				_mm512_setzero_pd(), _CMP_GE_OQ)))
+	{
+		root = root_avx512(&s->sp, k, r);
+		best_k = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(root, best,
+					_CMP_LT_OQ), best_k, _mm512_add_pd(_mm512_set1_pd(k),
+					_mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0)));
+		best = _mm512_min_pd(root, best);
+		k += 8;
+	}
+	_mm512_storeu_pd(lane[0], best);
+	_mm512_storeu_pd(lane[1], best_k);
+	_mm256_zeroupper();
+	return (kernel_pick(lane, 8, t));
+}
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_avx_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:16:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifdef SIMD_KERNELS
+# include <immintrin.h>
+
+// terms_sse() for the spheres k .. k + 3, with AVX
+__attribute__((target("avx")))
+static void	terms_avx(t_sphere_soa *sp, int k, t_kernel_ray *r,
+		__m256d term[2])
+{
+	__m256d	oc[3];
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		oc[i] = _mm256_sub_pd(_mm256_set1_pd(r->o[i]),
+				_mm256_loadu_pd(sp->center[i] + k));
+	term[0] = _mm256_mul_pd(_mm256_set1_pd(2), _mm256_add_pd(_mm256_add_pd(
+					_mm256_mul_pd(_mm256_set1_pd(r->d[0]), oc[0]),
+					_mm256_mul_pd(_mm256_set1_pd(r->d[1]), oc[1])),
+				_mm256_mul_pd(_mm256_set1_pd(r->d[2]), oc[2])));
+	term[1] = _mm256_sub_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(oc[0],
+						oc[0]), _mm256_mul_pd(oc[1], oc[1])),
+				_mm256_mul_pd(oc[2], oc[2])), _mm256_loadu_pd(sp->radius_sq
+				+ k));
+	term[1] = _mm256_sub_pd(_mm256_mul_pd(term[0], term[0]),
+			_mm256_mul_pd(_mm256_set1_pd(r->four_a), term[1]));
+}
+
+// root_sse() for the 4 spheres k .. k + 3, with AVX
+__attribute__((target("avx")))
+static __m256d	root_avx(t_sphere_soa *sp, int k, t_kernel_ray *r)
+{
+	__m256d	term[2];
+	__m256d	nb;
+	__m256d	sq;
+	__m256d	t;
+
+	terms_avx(sp, k, r, term);
+	nb = _mm256_sub_pd(_mm256_setzero_pd(), term[0]);
+	sq = _mm256_sqrt_pd(term[1]);
+	t = _mm256_div_pd(_mm256_sub_pd(nb, sq), _mm256_set1_pd(r->two_a));
+	t = _mm256_blendv_pd(_mm256_div_pd(_mm256_add_pd(nb, sq),
+				_mm256_set1_pd(r->two_a)), t, _mm256_cmp_pd(t,
+				_mm256_set1_pd(HIT_EPS), _CMP_GT_OQ));
+	return (_mm256_blendv_pd(_mm256_set1_pd(INFINITY), t, _mm256_and_pd(
+				_mm256_cmp_pd(t, _mm256_set1_pd(HIT_EPS), _CMP_GT_OQ),
+				_mm256_cmp_pd(term[1], _mm256_setzero_pd(), _CMP_GE_OQ))));
+}
+
+/* spheres_avx()
+	spheres_sse() 4 spheres at a time, with AVX. Only called if the CPU
+	supports it (see kernel_simd_level()), the upper halves of the
+	registers are cleared before returning, as in wbvh_test_avx().
+*/
+__attribute__((target("avx")))
+int	spheres_avx(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	__m256d	best;
+	__m256d	best_k;
+	__m256d	root;
+	double	lane[2][8];
+	int		k;
+
+	best = _mm256_set1_pd(*t);
+	best_k = _mm256_set1_pd(-1);
+	k = blk[0];
+	while (k < blk[0] + blk[1] && !(r->any && _mm256_movemask_pd(
+				_mm256_cmp_pd(best_k, _mm256_setzero_pd(), _CMP_GE_OQ))))
+	{
+		root = root_avx(&s->sp, k, r);
+		best_k = _mm256_blendv_pd(best_k, _mm256_set_pd(k + 3, k + 2, k + 1,
+					k), _mm256_cmp_pd(root, best, _CMP_LT_OQ));
+		best = _mm256_min_pd(root, best);
+		k += 4;
+	}
+	_mm256_storeu_pd(lane[0], best);
+	_mm256_storeu_pd(lane[1], best_k);
+	_mm256_zeroupper();
+	return (kernel_pick(lane, 4, t));
+}
+
+/* kernel_simd_level()
+	SSE2 is part of x86-64, AVX and AVX-512F are checked at run time
+	(CPUID, and whether the system saves their registers)
+*/
+t_simd_level	kernel_simd_level(void)
+{
+	if (__builtin_cpu_supports("avx512f"))
+		return (SIMD_AVX512);
+	if (__builtin_cpu_supports("avx"))
+		return (SIMD_AVX);
+	return (SIMD_SSE);
+}
+#endif
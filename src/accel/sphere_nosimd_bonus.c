@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_nosimd_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:16:04 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifndef SIMD_KERNELS
+
+// other CPUs and the float build (see SIMD_KERNELS): no SIMD sphere
+// kernel, kernel_simd_level() says so and prim_hit_range() tests the
+// spheres one at a time
+int	spheres_sse(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	return (kernel_scalar(s, blk, r, t));
+}
+
+int	spheres_avx(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	return (kernel_scalar(s, blk, r, t));
+}
+
+int	spheres_avx512(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	return (kernel_scalar(s, blk, r, t));
+}
+
+t_simd_level	kernel_simd_level(void)
+{
+	return (SIMD_NONE);
+}
+#endif
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_sse_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:16:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifdef SIMD_KERNELS
+# include <immintrin.h>
+
+// b where the mask is set, a elsewhere (SSE2 has no blendv)
+static __m128d	select_sse(__m128d mask, __m128d a, __m128d b)
+{
+	return (_mm_or_pd(_mm_and_pd(mask, b), _mm_andnot_pd(mask, a)));
+}
+
+/* terms_sse()
+	b and the discriminant of sphere_root(), for the spheres k and k + 1,
+	with the same operations in the same order, lane by lane
+*/
+static void	terms_sse(t_sphere_soa *sp, int k, t_kernel_ray *r,
+		__m128d term[2])
+{
+	__m128d	oc[3];
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		oc[i] = _mm_sub_pd(_mm_set1_pd(r->o[i]), _mm_loadu_pd(sp->center[i]
+					+ k));
+	term[0] = _mm_mul_pd(_mm_set1_pd(2), _mm_add_pd(_mm_add_pd(_mm_mul_pd(
+						_mm_set1_pd(r->d[0]), oc[0]), _mm_mul_pd(
+						_mm_set1_pd(r->d[1]), oc[1])), _mm_mul_pd(
+					_mm_set1_pd(r->d[2]), oc[2])));
+	term[1] = _mm_sub_pd(_mm_mul_pd(term[0], term[0]), _mm_mul_pd(
+				_mm_set1_pd(r->four_a), _mm_sub_pd(_mm_add_pd(_mm_add_pd(
+							_mm_mul_pd(oc[0], oc[0]), _mm_mul_pd(oc[1], oc[1])),
+						_mm_mul_pd(oc[2], oc[2])),
+					_mm_loadu_pd(sp->radius_sq + k))));
+}
+
+// sphere_root() of the spheres k and k + 1 at once, with SSE2
+// Return the 2 distances, INFINITY where the ray misses
+static __m128d	root_sse(t_sphere_soa *sp, int k, t_kernel_ray *r)
+{
+	__m128d	term[2];
+	__m128d	nb;
+	__m128d	sq;
+	__m128d	t;
+
+	terms_sse(sp, k, r, term);
+	nb = _mm_sub_pd(_mm_setzero_pd(), term[0]);
+	sq = _mm_sqrt_pd(term[1]);
+	t = _mm_div_pd(_mm_sub_pd(nb, sq), _mm_set1_pd(r->two_a));
+	t = select_sse(_mm_cmpgt_pd(t, _mm_set1_pd(HIT_EPS)), _mm_div_pd(
+				_mm_add_pd(nb, sq), _mm_set1_pd(r->two_a)), t);
+	return (select_sse(_mm_and_pd(_mm_cmpgt_pd(t, _mm_set1_pd(HIT_EPS)),
+				_mm_cmpge_pd(term[1], _mm_setzero_pd())),
+			_mm_set1_pd(INFINITY), t));
+}
+
+/* spheres_sse()
+	kernel_scalar() on spheres, 2 at a time: each lane keeps the closest of
+	its spheres, strictly closer than *t, and the index of that sphere;
+	kernel_pick() then takes the closest lane. blk[1] is even. For an
+	occlusion test (r->any), it stops after the first block with a hit.
+	Return the sphere, -1 if none, *t being set to its distance
+*/
+int	spheres_sse(t_prim_soa *s, int blk[3], t_kernel_ray *r, double *t)
+{
+	__m128d	best;
+	__m128d	best_k;
+	__m128d	root;
+	double	lane[2][8];
+	int		k;
+
+	best = _mm_set1_pd(*t);
+	best_k = _mm_set1_pd(-1);
+	k = blk[0];
+	while (k < blk[0] + blk[1] && !(r->any
+			&& _mm_movemask_pd(_mm_cmpge_pd(best_k, _mm_setzero_pd()))))
+	{
+		root = root_sse(&s->sp, k, r);
+		best_k = select_sse(_mm_cmplt_pd(root, best), best_k,
+				_mm_set_pd(k + 1, k));
+		best = _mm_min_pd(root, best);
+		k += 2;
+	}
+	_mm_storeu_pd(lane[0], best);
+	_mm_storeu_pd(lane[1], best_k);
+	return (kernel_pick(lane, 2, t));
+}
+
+#endif
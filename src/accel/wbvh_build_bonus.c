@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wbvh_build_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:11:05 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:11:05 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* open_slots()
+	Picks the children of the wide node made from the binary node `bin`:
+	starting from `bin` itself, the inner node with the largest surface area
+	is replaced by its two children, until there are `width` of them or
+	only leaves are left (large boxes are the ones most rays go through).
+	Return: the number of children stored in slots[]
+*/
+static int	open_slots(t_accel *acc, int bin, int width, int *slots)
+{
+	t_bvh_node	*nodes;
+	int			best;
+	int			n;
+	int			i;
+
+	nodes = acc->nodes;
+	slots[0] = bin;
+	n = 1;
+	while (n < width)
+	{
+		best = -1;
+		i = -1;
+		while (++i < n)
+		{
+			if (nodes[slots[i]].count == 0 && (best < 0
+					|| aabb_area(nodes[slots[i]].box)
+					> aabb_area(nodes[slots[best]].box)))
+				best = i;
+		}
+		if (best < 0)
+			break ;
+		slots[n++] = nodes[slots[best]].left_first + 1;
+		slots[best] = nodes[slots[best]].left_first;
+	}
+	return (n);
+}
+
+/* collapse()
+	Creates the wide node of the binary node `bin` and, recursively, the
+	wide nodes of its inner children
+	Return: the index of the new wide node
+*/
+static int	collapse(t_accel *acc, int bin, int width)
+{
+	int			slots[WBVH_MAX];
+	t_wbvh_node	*w;
+	int			wi;
+	int			i;
+
+	wi = acc->wnode_count++;
+	w = &acc->wnodes[wi];
+	*w = (t_wbvh_node){0};
+	w->used = open_slots(acc, bin, width, slots);
+	i = -1;
+	while (++i < w->used)
+	{
+		wbvh_set_lane(w, i, &acc->nodes[slots[i]].box);
+		w->count[i] = acc->nodes[slots[i]].count;
+		w->child[i] = acc->nodes[slots[i]].left_first;
+		if (w->count[i] == 0)
+			w->child[i] = collapse(acc, slots[i], width);
+	}
+	return (wi);
+}
+
+/* wbvh_build()
+	Collapses the binary BVH (already built) into a 4 or 8 wide one.
+	Every wide node comes from a different binary node, so there are at most
+	acc->node_count of them. The binary tree is kept.
+	Return 1 on success, 0 on allocation failure
+*/
+int	wbvh_build(t_accel *acc, int width)
+{
+	acc->width = width;
+	acc->simd = wbvh_simd_level(width);
+	acc->wnode_count = 0;
+	if (acc->node_count == 0)
+		return (1);
+	acc->wnodes = malloc(sizeof(t_wbvh_node) * acc->node_count);
+	if (!acc->wnodes)
+		return (0);
+	collapse(acc, 0, width);
+	return (1);
+}
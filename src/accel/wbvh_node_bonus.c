@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wbvh_node_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:11:05 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:11:05 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// nearest float below (dir < 0) or above (dir > 0) `x`
+static float	round_out(double x, float dir)
+{
+	float	f;
+
+	f = (float)x;
+	if ((dir < 0 && (double)f > x) || (dir > 0 && (double)f < x))
+		f = nextafterf(f, dir * INFINITY);
+	return (f);
+}
+
+/* wbvh_set_lane()
+	Stores `box` as the box of the child `lane`, in floats rounded outwards:
+	the float box may only be larger than the real one, never smaller
+*/
+void	wbvh_set_lane(t_wbvh_node *node, int lane, t_aabb *box)
+{
+	node->bmin[0][lane] = round_out(box->min.x, -1.0f);
+	node->bmin[1][lane] = round_out(box->min.y, -1.0f);
+	node->bmin[2][lane] = round_out(box->min.z, -1.0f);
+	node->bmax[0][lane] = round_out(box->max.x, 1.0f);
+	node->bmax[1][lane] = round_out(box->max.y, 1.0f);
+	node->bmax[2][lane] = round_out(box->max.z, 1.0f);
+}
+
+// scalar slab test of the child `lane`, its entry distance goes to tnear[]
+static int	lane_hit(t_wbvh_node *node, t_wbvh_trav *tr, int lane)
+{
+	float	t0;
+	float	t1;
+	float	tmin;
+	float	tmax;
+	int		a;
+
+	tmin = 0.0f;
+	tmax = tr->tfar;
+	a = -1;
+	while (++a < 3)
+	{
+		t0 = (node->bmin[a][lane] - tr->org[a]) * tr->inv[a];
+		t1 = (node->bmax[a][lane] - tr->org[a]) * tr->inv[a];
+		tmin = fmaxf(tmin, fminf(t0, t1));
+		tmax = fminf(tmax, fmaxf(t0, t1));
+	}
+	tr->tnear[lane] = tmin;
+	return (tmin <= tmax);
+}
+
+/* wbvh_test_node()
+	Tests the ray against the boxes of all the children of a wide node, with
+	the widest instruction set available: one AVX test for a BVH8 node, one
+	(BVH4) or two (BVH8) SSE tests, or a plain loop over the children.
+	Return: bit mask of the children hit (bit i: child i), their entry
+		distances are in tr->tnear[]
+*/
+int	wbvh_test_node(t_accel *acc, t_wbvh_node *node, t_wbvh_trav *tr)
+{
+	int	mask;
+	int	i;
+
+	tr->tfar = nextafterf((float)tr->t_max, INFINITY);
+	mask = 0;
+	if (acc->simd == SIMD_AVX)
+		mask = wbvh_test_avx(node, tr);
+	else if (acc->simd == SIMD_SSE)
+	{
+		mask = wbvh_test_sse(node, tr, 0);
+		if (node->used > 4)
+			mask |= wbvh_test_sse(node, tr, 4);
+	}
+	else
+	{
+		i = -1;
+		while (++i < node->used)
+			mask |= lane_hit(node, tr, i) << i;
+	}
+	return (mask & ((1 << node->used) - 1));
+}
@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wbvh_nosimd_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:11:36 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:11:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifndef __x86_64__
+
+// other CPUs: no SIMD box test, wbvh_test_node() tests one child at a time
+int	wbvh_test_sse(t_wbvh_node *node, t_wbvh_trav *tr, int k)
+{
+	(void)node;
+	(void)tr;
+	(void)k;
+	return (0);
+}
+
+int	wbvh_test_avx(t_wbvh_node *node, t_wbvh_trav *tr)
+{
+	(void)node;
+	(void)tr;
+	return (0);
+}
+
+t_simd_level	wbvh_simd_level(int width)
+{
+	(void)width;
+	return (SIMD_NONE);
+}
+#endif
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wbvh_simd_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:11:05 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:13:04 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifdef __x86_64__
+# include <immintrin.h>
+
+/* wbvh_test_sse()
+	Slab test of the ray against the 4 children k .. k + 3 of a wide node,
+	with SSE. The entry distances go to tr->tnear[k ..].
+	The min/max operand order makes a NaN (0 * inf, a ray starting exactly
+	on a slab parallel to it) fall back to the previous bound.
+	Return: bit mask of the children hit, shifted to lane k
+*/
+int	wbvh_test_sse(t_wbvh_node *node, t_wbvh_trav *tr, int k)
+{
+	__m128	t0;
+	__m128	t1;
+	__m128	tmin;
+	__m128	tmax;
+	int		a;
+
+	tmin = _mm_setzero_ps();
+	tmax = _mm_set1_ps(tr->tfar);
+	a = -1;
+	while (++a < 3)
+	{
+		t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node->bmin[a][k]),
+					_mm_set1_ps(tr->org[a])), _mm_set1_ps(tr->inv[a]));
+		t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node->bmax[a][k]),
+					_mm_set1_ps(tr->org[a])), _mm_set1_ps(tr->inv[a]));
+		tmin = _mm_max_ps(_mm_min_ps(t0, t1), tmin);
+		tmax = _mm_min_ps(_mm_max_ps(t0, t1), tmax);
+	}
+	_mm_storeu_ps(&tr->tnear[k], tmin);
+	return (_mm_movemask_ps(_mm_cmple_ps(tmin, tmax)) << k);
+}
+
+/* wbvh_test_avx()
+	Same as wbvh_test_sse() for all the 8 children at once, with AVX.
+	Only called if the CPU supports it (see wbvh_simd_level()), the rest
+	of the program is compiled without AVX: the upper halves of the
+	registers are cleared before returning, mixing dirty AVX registers with
+	the SSE code of the caller costs more than the whole test.
+*/
+__attribute__((target("avx")))
+int	wbvh_test_avx(t_wbvh_node *node, t_wbvh_trav *tr)
+{
+	__m256	t0;
+	__m256	t1;
+	__m256	tmin;
+	__m256	tmax;
+	int		a;
+
+	tmin = _mm256_setzero_ps();
+	tmax = _mm256_set1_ps(tr->tfar);
+	a = -1;
+	while (++a < 3)
+	{
+		t0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(node->bmin[a]),
+					_mm256_set1_ps(tr->org[a])), _mm256_set1_ps(tr->inv[a]));
+		t1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(node->bmax[a]),
+					_mm256_set1_ps(tr->org[a])), _mm256_set1_ps(tr->inv[a]));
+		tmin = _mm256_max_ps(_mm256_min_ps(t0, t1), tmin);
+		tmax = _mm256_min_ps(_mm256_max_ps(t0, t1), tmax);
+	}
+	_mm256_storeu_ps(tr->tnear, tmin);
+	a = _mm256_movemask_ps(_mm256_cmp_ps(tmin, tmax, _CMP_LE_OQ));
+	_mm256_zeroupper();
+	return (a);
+}
+
+/* wbvh_simd_level()
+	SSE is part of x86-64, AVX is checked at run time (CPUID)
+*/
+t_simd_level	wbvh_simd_level(int width)
+{
+	if (width == 8 && __builtin_cpu_supports("avx"))
+		return (SIMD_AVX);
+	return (SIMD_SSE);
+}
+#endif
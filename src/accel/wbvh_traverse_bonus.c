@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wbvh_traverse_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:11:47 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// prepares the traversal of one ray, the root node is always visited
+static void	wtrav_init(t_accel *acc, t_wbvh_trav *tr, t_ray *ray,
+		t_real t_max)
+{
+	tr->ray = ray;
+	tr->org[0] = ray->origin.x;
+	tr->org[1] = ray->origin.y;
+	tr->org[2] = ray->origin.z;
+	tr->inv[0] = 1.0 / ray->direction.x;
+	tr->inv[1] = 1.0 / ray->direction.y;
+	tr->inv[2] = 1.0 / ray->direction.z;
+	tr->t_max = t_max;
+	tr->sp = 0;
+	if (acc->wnode_count == 0)
+		return ;
+	tr->stack[0] = 0;
+	tr->dist[0] = 0.0f;
+	tr->sp = 1;
+}
+
+/* push_inner()
+	Pushes the inner children hit by the ray, sorted so that the closest one
+	ends up on top of the stack and is visited first (insertion sort over
+	the at most WBVH_MAX entries pushed)
+*/
+static void	push_inner(t_wbvh_trav *tr, t_wbvh_node *node, int mask)
+{
+	int	base;
+	int	i;
+	int	j;
+
+	base = tr->sp;
+	i = -1;
+	while (++i < node->used)
+	{
+		if (!(mask & (1 << i)) || node->count[i] != 0
+			|| tr->tnear[i] > tr->t_max || tr->sp >= WBVH_STACK_SIZE)
+			continue ;
+		j = tr->sp++;
+		while (j > base && tr->dist[j - 1] < tr->tnear[i])
+		{
+			tr->stack[j] = tr->stack[j - 1];
+			tr->dist[j] = tr->dist[j - 1];
+			j--;
+		}
+		tr->stack[j] = node->child[i];
+		tr->dist[j] = tr->tnear[i];
+	}
+}
+
+/* hit_leaves()
+	Intersects the primitives of the leaf children hit by the ray
+	Input:
+		*rec:	closest-hit: the record is overwritten by every closer hit,
+				rec->t is tr->t_max
+				any-hit (NULL): the first hit ends the search
+	Return 1 if anything closer than tr->t_max was hit, 0 otherwise
+*/
+static int	hit_leaves(t_accel *acc, t_wbvh_trav *tr, t_wbvh_node *node,
+		t_hit_record *rec)
+{
+	int	range[2];
+	int	mask;
+	int	hit;
+	int	i;
+
+	mask = wbvh_test_node(acc, node, tr);
+	hit = 0;
+	i = -1;
+	while (++i < node->used)
+	{
+		if (!(mask & (1 << i)) || node->count[i] == 0)
+			continue ;
+		range[0] = node->child[i];
+		range[1] = node->child[i] + node->count[i];
+		if (!rec && prim_occludes_range(acc, range, tr->ray, tr->t_max))
+			return (1);
+		if (rec && prim_hit_range(acc, range, tr->ray, rec))
+		{
+			tr->t_max = rec->t;
+			hit = 1;
+		}
+	}
+	push_inner(tr, node, mask);
+	return (hit);
+}
+
+/* wbvh_closest_hit()
+	Walks the wide BVH for the closest hit: each node tests all its
+	children's boxes at once, intersects the leaves hit right away and
+	pushes the inner children hit, closest on top
+	Return 1 if a closer hit than rec->t was found in the tree, 0 otherwise
+*/
+int	wbvh_closest_hit(t_accel *acc, t_ray *ray, t_hit_record *rec)
+{
+	t_wbvh_trav	tr;
+	int			hit;
+
+	wtrav_init(acc, &tr, ray, rec->t);
+	hit = 0;
+	while (tr.sp-- > 0)
+	{
+		if (tr.dist[tr.sp] > tr.t_max)
+			continue ;
+		if (hit_leaves(acc, &tr, &acc->wnodes[tr.stack[tr.sp]], rec))
+			hit = 1;
+	}
+	return (hit);
+}
+
+// occlusion version for the shadow rays: stops at the first hit
+int	wbvh_any_hit(t_accel *acc, t_ray *ray, t_real t_max)
+{
+	t_wbvh_trav	tr;
+
+	wtrav_init(acc, &tr, ray, t_max);
+	while (tr.sp-- > 0)
+	{
+		if (hit_leaves(acc, &tr, &acc->wnodes[tr.stack[tr.sp]], NULL))
+			return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_report_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:12:09 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:28:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+char	*accel_name(t_accel_kind kind)
+{
+	if (kind == ACCEL_BVH)
+		return ("bvh");
+	if (kind == ACCEL_BVH4)
+		return ("bvh4");
+	if (kind == ACCEL_BVH8)
+		return ("bvh8");
+	if (kind == ACCEL_GRID)
+		return ("grid");
+	if (kind == ACCEL_HGRID)
+		return ("hgrid");
+	if (kind == ACCEL_QBVH8)
+		return ("qbvh8");
+	if (kind == ACCEL_QBVH16)
+		return ("qbvh16");
+	return ("linear");
+}
+
+// what the last accel_update() did, `rebuilds` was acc->rebuilds before it
+char	*accel_update_name(t_accel *acc, int rebuilds)
+{
+	if (acc->kind == ACCEL_LINEAR)
+		return ("none");
+	if (acc->rebuilds != rebuilds)
+		return ("rebuild");
+	return ("refit");
+}
+
+static char	*simd_name(t_simd_level simd)
+{
+	if (simd == SIMD_AVX)
+		return ("avx");
+	if (simd == SIMD_SSE)
+		return ("sse");
+	return ("scalar");
+}
+
+// bottom level: the groups and the objects they hold, whatever the number
+// of their instances
+static void	report_groups(t_group *group)
+{
+	int		groups;
+	long	objects;
+
+	groups = 0;
+	objects = 0;
+	while (group)
+	{
+		groups++;
+		objects += group->accel->prim_count;
+		group = group->next;
+	}
+	if (groups > 0)
+		printf("groups: %d, %ld objects in their bottom-level trees\n",
+			groups, objects);
+}
+
+/* accel_report()
+	Prints what init_program_data() built: node count, memory and build
+	time of the tree (nothing for --accel linear) and the groups
+	(see accel_stats_bonus.c for the grids and the quantized BVHs)
+*/
+void	accel_report(t_scene *scene)
+{
+	t_accel	*acc;
+
+	acc = scene->accel;
+	report_groups(scene->groups);
+	if (acc->kind == ACCEL_GRID || acc->kind == ACCEL_HGRID)
+		grid_report(scene);
+	if (acc->kind == ACCEL_QBVH8 || acc->kind == ACCEL_QBVH16)
+		qbvh_report(scene);
+	if (acc->kind == ACCEL_LINEAR || acc->kind >= ACCEL_GRID)
+		return ;
+	printf("BVH: %d nodes (%zu KiB) over %d objects", acc->node_count,
+		acc->node_count * sizeof(t_bvh_node) / 1024, acc->prim_count);
+	if (scene->cache)
+		printf(", from the cache\n");
+	else
+		printf(", built in %.1f ms (%s, %d threads)\n", acc->build_ms,
+			builder_name(acc->builder), acc->build_threads);
+	if (acc->kind == ACCEL_BVH4 || acc->kind == ACCEL_BVH8)
+		printf("%s: %d wide nodes (%zu KiB), %s box tests\n",
+			accel_name(acc->kind), acc->wnode_count, acc->wnode_count
+			* sizeof(t_wbvh_node) / 1024, simd_name(acc->simd));
+}
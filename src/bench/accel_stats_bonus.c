@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accel_stats_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:14:56 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:28:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+char	*builder_name(t_bvh_builder builder)
+{
+	if (builder == BUILD_LBVH)
+		return ("lbvh");
+	if (builder == BUILD_LBVH_OPT)
+		return ("lbvh-opt");
+	return ("sah");
+}
+
+// memory of the cells, of the blocks and of the lists of objects, in bytes
+static long	grid_bytes(t_grid *g)
+{
+	long	bytes;
+
+	bytes = sizeof(t_grid) + g->item_count * sizeof(int)
+		+ (long)g->bres[0] * g->bres[1] * g->bres[2];
+	if (g->slots)
+		return (bytes + (g->hash_mask + 1) * sizeof(t_grid_slot));
+	return (bytes + ((long)g->res[0] * g->res[1] * g->res[2] + 1)
+		* sizeof(int));
+}
+
+/* grid_report()
+	The grid counterpart of the BVH line of accel_report(): resolution,
+	cells holding something, references (an object overlapping k cells is
+	referenced k times) and memory
+*/
+void	grid_report(t_scene *scene)
+{
+	t_accel	*acc;
+	t_grid	*g;
+
+	acc = scene->accel;
+	g = acc->grid;
+	if (!g)
+		return ;
+	printf("%s: %dx%dx%d cells, %ld used, %ld refs (%.2f per object, %ld "
+		"KiB)", accel_name(acc->kind), g->res[0], g->res[1], g->res[2],
+		g->cell_count, g->item_count, (double)g->item_count
+		/ acc->prim_count, grid_bytes(g) / 1024);
+	if (scene->cache)
+		printf(", from the cache\n");
+	else
+		printf(", built in %.1f ms\n", acc->build_ms);
+}
+
+/* qbvh_report()
+	The quantized BVH counterpart of the BVH line of accel_report(): its
+	memory against that of the binary tree it replaced (2n + 1 nodes for
+	n inner ones, a single leaf for a node with a single child)
+*/
+void	qbvh_report(t_scene *scene)
+{
+	t_accel	*acc;
+	long	bytes;
+	long	full;
+
+	acc = scene->accel;
+	if (!acc->qnodes)
+		return ;
+	bytes = (long)acc->qnode_count * qbvh_node_size(acc->qbits);
+	full = (2L * acc->qnode_count + 1) * sizeof(t_bvh_node);
+	if (qbvh_node(acc, 0)->count[1] < 0)
+		full = sizeof(t_bvh_node);
+	printf("%s: %d nodes of %d bytes (%ld KiB, binary BVH: %ld KiB, %.1fx "
+		"smaller) over %d objects", accel_name(acc->kind), acc->qnode_count,
+		qbvh_node_size(acc->qbits), bytes / 1024, full / 1024,
+		(double)full / max(bytes, 1), acc->prim_count);
+	if (scene->cache)
+		printf(", from the cache\n");
+	else
+		printf(", built in %.1f ms (%s, %d threads)\n", acc->build_ms,
+			builder_name(acc->builder), acc->build_threads);
+}
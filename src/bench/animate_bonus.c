@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   animate_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:21:48 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:28:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the point that places the object: moving it moves the whole object
+static t_point3	*object_origin(t_object *obj)
+{
+	if (obj->type == SPHERE)
+		return (&((t_sphere *)obj->shape_data)->center);
+	if (obj->type == CYLINDER)
+		return (&((t_cylinder *)obj->shape_data)->center);
+	if (obj->type == CONE)
+		return (&((t_cone *)obj->shape_data)->tip);
+	return (&((t_instance *)obj->shape_data)->pos);
+}
+
+/* anim_init()
+	Picks one bounded object out of `stride`, in the order of the scene
+	file, so that all the --accel kinds move the same ones. They move by
+	ANIM_SPEED times the size of the scene per frame.
+	Return 1 on success, 0 on allocation failure
+*/
+static int	anim_init(t_scene *scene, t_anim *an, int stride)
+{
+	t_object	*obj;
+	t_aabb		box;
+	int			i;
+
+	*an = (t_anim){0};
+	an->moved = malloc(sizeof(t_object *) * (scene->accel->prim_count
+				/ stride + 1));
+	if (!an->moved)
+		return (0);
+	box = aabb_empty();
+	i = 0;
+	obj = scene->objects;
+	while (obj)
+	{
+		box = aabb_union(box, object_bounds(obj));
+		if (obj->type != PLANE && i++ % stride == 0)
+			an->moved[an->count++] = obj;
+		obj = obj->next;
+	}
+	an->speed = vec3_length(vec3_sub(box.max, box.min)) * ANIM_SPEED;
+	printf("animate: %d of %d objects moving\n", an->count, i);
+	return (1);
+}
+
+// each object moves in its own horizontal direction
+static void	move_objects(t_anim *an)
+{
+	t_point3	*origin;
+	int			i;
+
+	i = -1;
+	while (++i < an->count)
+	{
+		origin = object_origin(an->moved[i]);
+		*origin = vec3_add(*origin, vec3_mul((t_vec3){cos(i * 2.4), 0.0,
+					sin(i * 2.4)}, an->speed));
+	}
+}
+
+/* anim_frame()
+	One frame: moves the objects, updates the accel and renders the image.
+	Prints the time of both, whether the BVH was refitted or rebuilt and
+	its SAH cost relative to the cost right after its last build.
+	Return 1 on success, 0 if the update failed
+*/
+static int	anim_frame(t_program_data *data, t_anim *an, int frame)
+{
+	t_accel	*acc;
+	double	start;
+	double	update_ms;
+	int		rebuilds;
+	double	sah;
+
+	acc = data->scene->accel;
+	move_objects(an);
+	rebuilds = acc->rebuilds;
+	start = time_now_ms();
+	if (!accel_update(acc, an->moved, an->count, option_threads(&data->opt)))
+		return (0);
+	update_ms = time_now_ms() - start;
+	sah = accel_sah_growth(acc);
+	if (acc->rebuilds != rebuilds)
+		an->rebuild_ms += update_ms;
+	else
+		an->refit_ms += update_ms;
+	start = time_now_ms();
+	render(data->scene, data->mlx);
+	printf("frame %3d: %-7s %8.2f ms, SAH x%.3f, render %.1f ms\n", frame,
+		accel_update_name(acc, rebuilds), update_ms, sah,
+		time_now_ms() - start);
+	return (1);
+}
+
+/* run_animation()
+	--animate N: renders N frames headless, with a few objects moving
+	between frames, and prints how long keeping the accel up to date took:
+	refits against rebuilds (see accel_update())
+*/
+void	run_animation(t_program_data *data)
+{
+	t_accel	*acc;
+	t_anim	an;
+	int		frame;
+
+	acc = data->scene->accel;
+	frame = 0;
+	if (!anim_init(data->scene, &an, data->opt.stride))
+		error_msg("Animate: memory allocation failed");
+	while (an.moved && frame < data->opt.animate
+		&& anim_frame(data, &an, frame))
+		frame++;
+	if (acc->kind != ACCEL_LINEAR)
+		printf("update:  %d refits %.3f ms avg, %d rebuilds %.1f ms avg\n",
+			acc->refits, an.refit_ms / max(acc->refits, 1), acc->rebuilds,
+			an.rebuild_ms / max(acc->rebuilds, 1));
+	printf("image:   checksum %08x (last frame)\n", image_checksum(data->mlx,
+			data->scene->width, data->scene->height));
+	free(an.moved);
+}
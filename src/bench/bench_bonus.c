@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:00:10 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:29:06 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// wall clock time in milliseconds, for timings only
+double	time_now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6);
+}
+
+static void	print_scene_stats(t_scene *scene)
+{
+	t_accel	*acc;
+
+	acc = scene->accel;
+	printf("scene:   %d x %d, %d objects + %d planes\n", scene->width,
+		scene->height, acc->prim_count, acc->plane_count);
+	printf("accel:   %s\n", accel_name(acc->kind));
+}
+
+// peak memory use of the process so far (ru_maxrss is in KiB on Linux)
+static void	print_memory(void)
+{
+	struct rusage	usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+		printf("memory:  %.1f MiB peak\n", usage.ru_maxrss / 1024.0);
+}
+
+/* image_checksum()
+	FNV-1a hash of the rendered pixels: two renders of the same scene
+	(e.g. with different --accel backends) must print the same checksum
+*/
+unsigned int	image_checksum(t_mlx_data *mlx, int width, int height)
+{
+	unsigned int	hash;
+	unsigned char	*p;
+	long			i;
+	long			size;
+
+	hash = 2166136261u;
+	p = (unsigned char *)mlx->addr;
+	size = (long)width * height * 4;
+	i = -1;
+	while (++i < size)
+		hash = (hash ^ p[i]) * 16777619u;
+	return (hash);
+}
+
+/* run_bench()
+	--bench: renders the scene once into the headless image buffer and
+	prints how long it took and how many rays per second were traced, and
+	how the threads shared the frame (see render_stats_report()).
+	Rays are counted by the acceleration structure: closest-hit queries
+	(camera and reflection rays) plus any-hit queries (shadow rays).
+	The ray / object tests are counted by prim_hit(), the cache misses of
+	the render by the hardware counters, if the machine gives them. The
+	image is saved or compared with --ppm and --diff (see image_report()).
+	The shadow rays are then timed on their own (see shadow_bench()), and
+	the primitive kernels (see kernel_bench()).
+*/
+void	run_bench(t_program_data *data)
+{
+	double	start;
+	double	ms;
+	long	rays;
+
+	print_scene_stats(data->scene);
+	perf_start(&data->perf);
+	start = time_now_ms();
+	render(data->scene, data->mlx);
+	ms = time_now_ms() - start;
+	perf_stop(&data->perf);
+	rays = prim_stats()->rays + prim_stats()->shadow_rays;
+	printf("render:  %.1f ms, %ld rays (%ld camera/reflection, %ld shadow)\n",
+		ms, rays, prim_stats()->rays, prim_stats()->shadow_rays);
+	printf("speed:   %.3f Mrays/s\n", rays / (ms * 1000.0));
+	render_stats_report();
+	prim_report();
+	perf_report(&data->perf);
+	printf("image:   checksum %08x\n", image_checksum(data->mlx,
+			data->scene->width, data->scene->height));
+	image_report(data);
+	print_memory();
+	shadow_bench(data->scene);
+	kernel_bench(data->scene);
+}
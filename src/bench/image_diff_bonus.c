@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   image_diff_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:55:44 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* diff_pixel()
+	Adds the difference of the pixels a and b to the sums of d:
+	d[0] sum of |a - b| over the channels, d[1] sum of (a - b)^2,
+	d[2] largest channel difference, d[3] pixels that differ,
+	d[4] pixels that differ by more than DIFF_VISIBLE in a channel
+*/
+static void	diff_pixel(unsigned char *a, unsigned char *b, long d[5])
+{
+	int	c;
+	int	e;
+	int	worst;
+
+	worst = 0;
+	c = -1;
+	while (++c < 3)
+	{
+		e = abs(a[c] - b[c]);
+		d[0] += e;
+		d[1] += e * e;
+		worst = max(worst, e);
+	}
+	d[2] = max(d[2], worst);
+	d[3] += worst > 0;
+	d[4] += worst > DIFF_VISIBLE;
+}
+
+// the report of --diff: mean absolute error of a channel (out of 255),
+// share of the pixels that differ and PSNR, for n pixels
+static void	print_diff(long d[5], long n)
+{
+	double	mse;
+
+	printf("diff:    max %ld, mean %.4f per channel, %.3f%% pixels differ "
+		"(%.3f%% by > %d)\n", d[2], d[0] / (3.0 * n), 100.0 * d[3] / n,
+		100.0 * d[4] / n, DIFF_VISIBLE);
+	mse = d[1] / (3.0 * n);
+	if (mse == 0.0)
+		printf("diff:    PSNR inf (identical images)\n");
+	else
+		printf("diff:    PSNR %.2f dB\n", 10.0 * log10(255.0 * 255.0 / mse));
+}
+
+// --diff FILE: compares the rendered pixels with those of the PPM image
+static void	image_diff(char *path, unsigned char *rgb, int width, int height)
+{
+	unsigned char	*ref;
+	long			d[5];
+	long			i;
+
+	ref = ppm_read(path, width, height);
+	if (!ref)
+		return ;
+	ft_bzero(d, sizeof(d));
+	i = -1;
+	while (++i < (long)width * height)
+		diff_pixel(rgb + i * 3, ref + i * 3, d);
+	free(ref);
+	print_diff(d, (long)width * height);
+}
+
+/* image_report()
+	After a --bench render: saves the image with --ppm FILE, compares it
+	with a reference image with --diff FILE, e.g. the same scene rendered
+	by the double and the float build (see tools/precision_diff.sh)
+*/
+void	image_report(t_program_data *data)
+{
+	unsigned char	*rgb;
+	int				width;
+	int				height;
+
+	if (!data->opt.ppm && !data->opt.diff)
+		return ;
+	width = data->scene->width;
+	height = data->scene->height;
+	rgb = image_rgb(data->mlx, width, height);
+	if (!rgb)
+	{
+		error_msg("--ppm, --diff: out of memory");
+		return ;
+	}
+	if (data->opt.ppm)
+		ppm_write(data->opt.ppm, rgb, width, height);
+	if (data->opt.diff)
+		image_diff(data->opt.diff, rgb, width, height);
+	free(rgb);
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   image_ppm_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:55:34 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* image_rgb()
+	The rendered image as width * height pixels of 3 bytes R, G, B, rows
+	from the top: the pixels of the PPM files of --ppm and --diff
+	Return the buffer (freed by the caller), NULL if out of memory
+*/
+unsigned char	*image_rgb(t_mlx_data *mlx, int width, int height)
+{
+	unsigned char	*rgb;
+	unsigned int	c;
+	long			i;
+
+	rgb = malloc((long)width * height * 3);
+	if (!rgb)
+		return (NULL);
+	i = -1;
+	while (++i < (long)width * height)
+	{
+		c = *(unsigned int *)(mlx->addr + i / width * mlx->line_length
+				+ i % width * 4);
+		rgb[i * 3] = (c >> 16) & 0xFF;
+		rgb[i * 3 + 1] = (c >> 8) & 0xFF;
+		rgb[i * 3 + 2] = c & 0xFF;
+	}
+	return (rgb);
+}
+
+/* ppm_write()
+	--ppm FILE: writes the pixels of image_rgb() as a binary PPM (P6)
+	Return 1 on success, 0 (with a message) if the file can't be written
+*/
+int	ppm_write(char *path, unsigned char *rgb, int width, int height)
+{
+	FILE	*f;
+	long	size;
+	int		ok;
+
+	f = fopen(path, "wb");
+	if (!f)
+		return (error_msg("--ppm: cannot create the image file"));
+	size = (long)width * height * 3;
+	ok = fprintf(f, "P6\n%d %d\n255\n", width, height) > 0
+		&& (long)fwrite(rgb, 1, size, f) == size;
+	if (fclose(f) != 0 || !ok)
+		return (error_msg("--ppm: cannot write the image file"));
+	return (1);
+}
+
+/* ppm_read()
+	--diff FILE: reads a binary PPM of 8-bit channels, as ppm_write()
+	writes them, that must be width x height pixels
+	Return its pixels (freed by the caller), NULL (with a message) if the
+	file can't be read or is not such an image
+*/
+unsigned char	*ppm_read(char *path, int width, int height)
+{
+	FILE			*f;
+	unsigned char	*rgb;
+	int				size[3];
+	long			n;
+
+	f = fopen(path, "rb");
+	if (!f)
+		return (error_msg("--diff: cannot open the image file"), NULL);
+	n = (long)width * height * 3;
+	rgb = NULL;
+	if (fscanf(f, "P6 %d %d %d", &size[0], &size[1], &size[2]) != 3
+		|| size[2] != 255 || fgetc(f) == EOF)
+		error_msg("--diff: not a binary PPM image");
+	else if (size[0] != width || size[1] != height)
+		error_msg("--diff: the image has another size than the render");
+	else
+		rgb = malloc(n);
+	if (rgb && (long)fread(rgb, 1, n, f) != n)
+	{
+		error_msg("--diff: the image file is truncated");
+		free(rgb);
+		rgb = NULL;
+	}
+	fclose(f);
+	return (rgb);
+}
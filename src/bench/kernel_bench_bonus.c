@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_bench_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:19:13 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// camera rays through job[1] pixels spread over the whole image, enough of
+// them for about KERNEL_BENCH_TESTS tests of the primitives of type job[0]
+static void	sample(t_scene *scene, t_kernel_probe *probe, int job[2])
+{
+	long	pixels;
+	long	p;
+	int		i;
+
+	job[1] = KERNEL_BENCH_TESTS / (scene->accel->soa.count[job[0]] + 1) + 1;
+	if (job[1] > KERNEL_BENCH_RAYS)
+		job[1] = KERNEL_BENCH_RAYS;
+	pixels = (long)scene->width * scene->height;
+	i = -1;
+	while (++i < job[1])
+	{
+		p = i * pixels / job[1];
+		probe[i].ray = get_ray(&scene->camera, p % scene->width,
+				p / scene->width);
+	}
+}
+
+// the intersection routine of the type on a copy of entry k, as prim_hit()
+// calls it: keeps the primitive if it is hit closer than p->t
+static void	hit_copy(t_prim_soa *s, int type, int k, t_kernel_probe *p)
+{
+	t_hit_record	rec;
+	t_sphere		sp;
+	t_cylinder		cy;
+	t_cone			co;
+
+	if (type == SPHERE)
+	{
+		sp = soa_sphere(s, k);
+		if (hit_sphere(&sp, &p->ray, p->t, &rec))
+			p->best = k;
+	}
+	else if (type == CYLINDER)
+	{
+		cy = soa_cylinder(s, k);
+		if (hit_cylinder(&cy, &p->ray, p->t, &rec))
+			p->best = k;
+	}
+	else if (type == CONE)
+	{
+		co = soa_cone(s, k);
+		if (hit_cone(&co, &p->ray, p->t, &rec))
+			p->best = k;
+	}
+	if (p->best == k)
+		p->t = rec.t;
+}
+
+/* time_reference()
+	The reference: each of the job[1] rays against all the primitives of
+	type job[0] one at a time, with their intersection routine, as
+	prim_hit() does. Keeps the closest primitive of each ray and its
+	distance.
+	Return the time it took, in ms
+*/
+static double	time_reference(t_prim_soa *s, t_kernel_probe *probe,
+		int job[2])
+{
+	double	ms;
+	int		i;
+	int		k;
+
+	ms = time_now_ms();
+	i = -1;
+	while (++i < job[1])
+	{
+		probe[i].t = INFINITY;
+		probe[i].best = -1;
+		k = -1;
+		while (++k < s->count[job[0]])
+			hit_copy(s, job[0], k, &probe[i]);
+	}
+	ms = time_now_ms() - ms;
+	printf("kernels: %d rays x %d %s, reference %.1f Mtests/s\n", job[1],
+		s->count[job[0]], (char *[]){"spheres", "planes", "cylinders",
+		"cones"}[job[0]], (double)job[1] * s->count[job[0]] / (ms * 1000.0));
+	return (ms);
+}
+
+/* time_level()
+	The same rays through kernel_closest(), with the kernels of s->simd
+	(the cylinders and cones have no SSE2 one). Prints the primitives tested
+	per second, the speedup over the reference and the rays whose closest
+	primitive or distance differ from it. The tolerance is 0: the kernels
+	compute what the intersection routines do, in the same order, there
+	should be none.
+*/
+static void	time_level(t_prim_soa *s, t_kernel_probe *probe, int job[2],
+		double ref)
+{
+	double	ms;
+	double	t;
+	int		wrong;
+	int		best;
+	int		i;
+
+	if (job[0] != SPHERE && s->simd == SIMD_SSE)
+		return ;
+	wrong = 0;
+	ms = time_now_ms();
+	i = -1;
+	while (++i < job[1])
+	{
+		t = INFINITY;
+		best = kernel_closest(s, (int [3]){0, s->count[job[0]], job[0]},
+				&probe[i].ray, &t);
+		if (best != probe[i].best || (best >= 0 && t != probe[i].t))
+			wrong++;
+	}
+	ms = time_now_ms() - ms;
+	printf("kernels: %-6s %.1f Mtests/s, %.2fx, %d rays differ\n",
+		(char *[]){"scalar", "sse", "avx", "avx512"}[s->simd],
+		(double)job[1] * s->count[job[0]] / (ms * 1000.0), ref / ms, wrong);
+}
+
+/* kernel_bench()
+	--bench: camera rays against all the spheres of the scene at once, then
+	all its cylinders and all its cones (types with at least 2), through
+	their intersection routine one primitive at a time, then through the
+	kernels of each SIMD level the CPU runs, about KERNEL_BENCH_TESTS tests
+	each (see time_level()). Without SIMD kernels (other CPUs, the float
+	build) the render tests the primitives one at a time: nothing to time.
+*/
+void	kernel_bench(t_scene *scene)
+{
+	t_kernel_probe	*probe;
+	t_prim_soa		*s;
+	double			ref;
+	int				level;
+	int				job[2];
+
+	if (kernel_simd_level() == SIMD_NONE)
+		return ;
+	s = &scene->accel->soa;
+	probe = malloc(sizeof(t_kernel_probe) * KERNEL_BENCH_RAYS);
+	level = s->simd;
+	job[0] = -1;
+	while (probe && ++job[0] <= CONE)
+	{
+		if (job[0] == PLANE || s->count[job[0]] < 2)
+			continue ;
+		sample(scene, probe, job);
+		ref = time_reference(s, probe, job);
+		s->simd = SIMD_NONE - 1;
+		while (++s->simd <= (int)kernel_simd_level())
+			time_level(s, probe, job, ref);
+	}
+	s->simd = level;
+	free(probe);
+}
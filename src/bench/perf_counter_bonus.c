@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf_counter_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:44:57 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:29:06 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// opens a counter of this process (and the threads it starts from now on),
+// stopped
+static int	perf_open(unsigned int type, unsigned long config)
+{
+	struct perf_event_attr	attr;
+
+	ft_bzero(&attr, sizeof(attr));
+	attr.type = type;
+	attr.size = sizeof(attr);
+	attr.config = config;
+	attr.disabled = 1;
+	attr.inherit = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/* perf_init()
+	Opens the hardware counters of --bench, stopped: cache references and
+	misses (last level) and L1 data cache read misses. A thread only
+	inherits the counters opened before it is started, so this is called
+	before the render threads are (see init_program_data()). A counter the
+	machine or the kernel doesn't give (no PMU in a VM,
+	perf_event_paranoid) is left closed (fd -1).
+*/
+void	perf_init(t_perf *p)
+{
+	p->fd[0] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES);
+	p->fd[1] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+	p->fd[2] = perf_open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+			| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+			| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+}
+
+// zeroes and starts the counters opened by perf_init()
+void	perf_start(t_perf *p)
+{
+	int	i;
+
+	i = -1;
+	while (++i < PERF_COUNTERS)
+	{
+		if (p->fd[i] < 0)
+			continue ;
+		ioctl(p->fd[i], PERF_EVENT_IOC_RESET, 0);
+		ioctl(p->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+// stops and closes the counters, p->count[i] is -1 for one that failed
+void	perf_stop(t_perf *p)
+{
+	int	i;
+
+	i = -1;
+	while (++i < PERF_COUNTERS)
+	{
+		p->count[i] = -1;
+		if (p->fd[i] < 0)
+			continue ;
+		ioctl(p->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+		if (read(p->fd[i], &p->count[i], sizeof(long)) != sizeof(long))
+			p->count[i] = -1;
+		close(p->fd[i]);
+	}
+}
+
+void	perf_report(t_perf *p)
+{
+	if (p->count[0] > 0 && p->count[1] >= 0)
+		printf("perf:    %ld cache misses of %ld references (%.1f%%)\n",
+			p->count[1], p->count[0], 100.0 * p->count[1] / p->count[0]);
+	if (p->count[2] >= 0)
+		printf("perf:    %ld L1 data read misses\n", p->count[2]);
+	if (p->count[0] <= 0 && p->count[2] < 0)
+		printf("perf:    no hardware counters (perf_event_open)\n");
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prim_report_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:30:48 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 01:25:50 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static char	*type_name(t_obj_type type)
+{
+	if (type == SPHERE)
+		return ("sphere");
+	if (type == PLANE)
+		return ("plane");
+	if (type == CYLINDER)
+		return ("cylinder");
+	return ("cone");
+}
+
+/* prim_report()
+	--bench: per object type, how many ray / object tests were made, how
+	many of them the bounding sphere rejected before the full test (see
+	prim_culled(); for the runs of spheres of the SIMD kernels, all but the
+	closest one) and how many were hits. Instances are not counted, the
+	objects of their groups are.
+*/
+void	prim_report(void)
+{
+	t_prim_stats	*st;
+	int				type;
+
+	st = prim_stats();
+	type = -1;
+	while (++type < INSTANCE)
+	{
+		if (st->tests[type] > 0)
+			printf("%-9s%ld tests, %ld rejected early (%.1f%%), %ld hits "
+				"(%.1f%%)\n", type_name(type), st->tests[type],
+				st->culled[type], 100.0 * st->culled[type] / st->tests[type],
+				st->hits[type], 100.0 * st->hits[type] / st->tests[type]);
+	}
+}
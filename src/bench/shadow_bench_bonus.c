@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_bench_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:00:59 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:35:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the shadow rays one by one (accel_any_hit()), whose answers are kept
+// Return the time they took, in ms
+static double	single_time(t_scene *scene, t_shadow_ray *rays, int n,
+		int *hidden)
+{
+	double	ms;
+	int		i;
+
+	*hidden = 0;
+	ms = time_now_ms();
+	i = -1;
+	while (++i < n)
+	{
+		rays[i].hidden = accel_any_hit(scene->accel, &rays[i].ray,
+				rays[i].t_max);
+		*hidden += rays[i].hidden;
+	}
+	return (time_now_ms() - ms);
+}
+
+/* packet_time()
+	The same shadow rays, in packets: the rays of a group (a tile toward a
+	light) together, as light_tile() traces them (see packet_any_hit()).
+	*differ counts the rays whose answer is not the one single_time() got.
+	Return the time they took, in ms
+*/
+static double	packet_time(t_scene *scene, t_shadow_ray *rays, int n,
+		int *differ)
+{
+	t_packet	pk;
+	double		ms;
+	int			i;
+	int			k;
+
+	*differ = 0;
+	ms = time_now_ms();
+	i = 0;
+	while (i < n)
+	{
+		pk.n = 0;
+		while (i + pk.n < n && pk.n < PACKET_MAX
+			&& rays[i + pk.n].group == rays[i].group)
+		{
+			pk.ray[pk.n] = rays[i + pk.n].ray;
+			pk.rec[pk.n].t = rays[i + pk.n].t_max;
+			pk.n++;
+		}
+		packet_any_hit(scene->accel, &pk);
+		k = -1;
+		while (++k < pk.n)
+			*differ += (int)(pk.hit >> k & 1) != rays[i + k].hidden;
+		i += pk.n;
+	}
+	return (time_now_ms() - ms);
+}
+
+/* shadow_bench()
+	--bench: times the shadow rays on their own. Once the image is done,
+	the shadow rays of a sample of its tiles are collected first (see
+	shadow_collect()), then only their occlusion queries are timed, in a
+	row: one by one, then in packets of the rays of a tile toward a light.
+	Prints the shadow rays per second each way, the share of them that
+	found the light hidden, and the rays the packets answered otherwise.
+*/
+void	shadow_bench(t_scene *scene)
+{
+	t_shadow_ray	*rays;
+	double			ms[2];
+	int				hidden;
+	int				differ;
+	int				n;
+
+	rays = malloc(sizeof(t_shadow_ray) * SHADOW_BENCH_RAYS);
+	if (!rays)
+		return ;
+	n = shadow_collect(scene, rays);
+	ms[0] = single_time(scene, rays, n, &hidden);
+	ms[1] = packet_time(scene, rays, n, &differ);
+	if (n > 0)
+	{
+		printf("shadow:  %d rays in %.1f ms, %.3f Mrays/s, %.1f%% hidden\n",
+			n, ms[0], n / (ms[0] * 1000.0), 100.0 * hidden / n);
+		printf("shadow:  packets of a tile by light: %.1f ms, %.3f Mrays/s, "
+			"%.2fx, %d rays differ\n", ms[1], n / (ms[1] * 1000.0),
+			ms[0] / ms[1], differ);
+	}
+	free(rays);
+}
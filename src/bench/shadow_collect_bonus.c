@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_collect_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:32:10 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:35:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the shadow ray from p toward light k, as calculate_lighting() casts it
+// Return 1 if it was set, 0 if the light is right on p
+static int	light_ray(t_light_soa *l, int k, t_point3 p, t_shadow_ray *r)
+{
+	t_vec3	to_light;
+
+	to_light = vec3_sub((t_point3){l->pos[0][k], l->pos[1][k],
+			l->pos[2][k]}, p);
+	r->t_max = vec3_length(to_light);
+	if (!(r->t_max > 0.0))
+		return (0);
+	r->ray.direction = vec3_div(to_light, r->t_max);
+	r->ray.origin = vec3_add(p, vec3_mul(r->ray.direction, HIT_EPS));
+	return (1);
+}
+
+// the points hit by the camera rays of the PACKET_SIZE x PACKET_SIZE tile
+// whose top left pixel is (at[0], at[1]), clipped to the image
+// Return their number
+static int	tile_points(t_scene *scene, int at[3], t_point3 *p)
+{
+	t_hit_record	rec;
+	t_ray			ray;
+	int				n;
+	int				i;
+
+	n = 0;
+	i = -1;
+	while (++i < PACKET_SIZE * PACKET_SIZE)
+	{
+		if (at[0] + i % PACKET_SIZE >= scene->width
+			|| at[1] + i / PACKET_SIZE >= scene->height)
+			continue ;
+		ray = get_ray(&scene->camera, at[0] + i % PACKET_SIZE,
+				at[1] + i / PACKET_SIZE);
+		if (accel_closest_hit(scene->accel, &ray, &rec))
+			p[n++] = rec.p;
+	}
+	return (n);
+}
+
+// the shadow rays of a tile, from its points toward each light in turn,
+// appended to rays[*n] while there is room. The rays toward light k make
+// group at[2] + k.
+static void	add_tile(t_scene *scene, int at[3], t_shadow_ray *rays, int *n)
+{
+	t_point3	p[PACKET_SIZE * PACKET_SIZE];
+	int			count;
+	int			k;
+	int			i;
+
+	count = tile_points(scene, at, p);
+	k = -1;
+	while (++k < scene->light_soa.count)
+	{
+		i = -1;
+		while (++i < count && *n < SHADOW_BENCH_RAYS)
+		{
+			rays[*n].group = at[2] + k;
+			*n += light_ray(&scene->light_soa, k, p[i], &rays[*n]);
+		}
+	}
+}
+
+/* shadow_collect()
+	Traces the camera rays of tiles of PACKET_SIZE x PACKET_SIZE pixels
+	spread over the whole image, and keeps the shadow rays of the points
+	they hit, up to SHADOW_BENCH_RAYS: those of a tile toward a light
+	follow each other, and make a group, as light_tile() traces them.
+	Return the number of shadow rays kept
+*/
+int	shadow_collect(t_scene *scene, t_shadow_ray *rays)
+{
+	long	tiles;
+	long	t;
+	int		cols;
+	int		n;
+
+	cols = (scene->width + PACKET_SIZE - 1) / PACKET_SIZE;
+	tiles = (long)cols * ((scene->height + PACKET_SIZE - 1) / PACKET_SIZE);
+	n = 0;
+	t = 0;
+	while (t < tiles && n < SHADOW_BENCH_RAYS)
+	{
+		add_tile(scene, (int [3]){t % cols * PACKET_SIZE, t / cols
+			* PACKET_SIZE, t * scene->light_soa.count}, rays, &n);
+		t += tiles * PACKET_SIZE * PACKET_SIZE * scene->light_soa.count
+			/ SHADOW_BENCH_RAYS + 1;
+	}
+	return (n);
+}
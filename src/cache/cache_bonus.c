@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:51:34 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:28:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the slow path: parse the scene file, build its accels
+static t_scene	*build_scene(t_options *opt)
+{
+	t_scene	*scene;
+
+	scene = parse_scene(opt->scene_file);
+	if (!scene)
+		return (NULL);
+	scene->accel = accel_create(scene, opt);
+	if (!scene->accel)
+		return (free_scene(scene), NULL);
+	return (scene);
+}
+
+/* load_scene()
+	Returns the scene and its accels, mapped from the cache file next to
+	the scene file (scene.rt.cache) if it is there and up to date, parsed
+	and built otherwise, and then saved to the cache for the next run.
+	--no-cache always parses and builds. So does --animate: refits and
+	rebuilds reallocate the accel's arrays, which can't be in a mapping.
+	Return the scene, NULL on failure (error already printed)
+*/
+t_scene	*load_scene(t_options *opt)
+{
+	t_scene			*scene;
+	unsigned long	key;
+	char			*path;
+	double			start;
+
+	start = time_now_ms();
+	path = NULL;
+	key = 0;
+	if (!opt->no_cache && !opt->animate)
+		path = ft_strjoin(opt->scene_file, CACHE_SUFFIX);
+	if (path)
+		key = cache_key(opt->scene_file, opt);
+	scene = NULL;
+	if (key)
+		scene = cache_load(path, key);
+	if (scene)
+		printf("cache: %s loaded in %.1f ms\n", path, time_now_ms() - start);
+	else
+		scene = build_scene(opt);
+	if (scene && !scene->cache && key && cache_save(scene, path, key))
+		printf("cache: %s written\n", path);
+	free(path);
+	return (scene);
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_grid_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:05:03 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:11:24 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* cache_put_grid()
+	Writes a grid and its arrays: the items, the blocks and the cells of
+	the plain grid (start) or those of the hashed one (slots).
+	The record is written last and linked to the accel written at the
+	offset `accel`: the arrays may move the data before that.
+*/
+void	cache_put_grid(t_cache_buf *cb, t_grid *g, long accel)
+{
+	t_grid	rec;
+	long	cells;
+	long	slots;
+	long	off;
+
+	if (!g)
+		return ;
+	rec = *g;
+	cells = ((long)g->res[0] * g->res[1] * g->res[2] + 1) * (!g->slots);
+	slots = (g->hash_mask + 1) * (g->slots != NULL);
+	rec.items = (int *)cache_put(cb, g->items, sizeof(int) * g->item_count);
+	rec.start = (int *)cache_put(cb, g->start, sizeof(int) * cells);
+	rec.slots = (t_grid_slot *)cache_put(cb, g->slots, sizeof(t_grid_slot)
+			* slots);
+	rec.blocks = (unsigned char *)cache_put(cb, g->blocks,
+			(long)g->bres[0] * g->bres[1] * g->bres[2]);
+	off = cache_put(cb, &rec, sizeof(t_grid));
+	if (!cb->failed)
+		((t_accel *)(cb->data + accel))->grid = (t_grid *)off;
+}
+
+// the grid of an accel loaded from the cache, and its arrays
+void	cache_reloc_grid(char *base, t_grid **grid)
+{
+	t_grid	*g;
+
+	*grid = cache_reloc(base, *grid);
+	g = *grid;
+	if (!g)
+		return ;
+	g->items = cache_reloc(base, g->items);
+	g->start = cache_reloc(base, g->start);
+	g->slots = cache_reloc(base, g->slots);
+	g->blocks = cache_reloc(base, g->blocks);
+}
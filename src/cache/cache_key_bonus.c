@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_key_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:49:58 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// FNV-1a, 64 bits
+static unsigned long	hash_bytes(unsigned long hash, void *data, long size)
+{
+	unsigned char	*p;
+	long			i;
+
+	p = data;
+	i = -1;
+	while (++i < size)
+		hash = (hash ^ p[i]) * 1099511628211UL;
+	return (hash);
+}
+
+// what the cached data depends on besides the scene file: the build
+// parameters and the layout of the cached structs, i.e. this build of miniRT
+static unsigned long	hash_params(unsigned long hash, t_options *opt)
+{
+	long	p[20];
+
+	p[0] = CACHE_VERSION;
+	p[1] = opt->accel + (opt->builder << 8);
+	p[2] = BVH_BINS;
+	p[3] = BVH_MAX_LEAF;
+	p[4] = BVH_MAX_SAH_DEPTH;
+	p[5] = BVH_TRAV_COST * 1000;
+	p[6] = sizeof(t_scene);
+	p[7] = sizeof(t_light);
+	p[8] = sizeof(t_object);
+	p[9] = sizeof(t_sphere) + (sizeof(t_plane) << 16);
+	p[10] = sizeof(t_cylinder) + (sizeof(t_cone) << 16);
+	p[11] = sizeof(t_instance) + (sizeof(t_group) << 16);
+	p[12] = sizeof(t_accel);
+	p[13] = sizeof(t_bvh_node);
+	p[14] = sizeof(t_wbvh_node);
+	p[15] = sizeof(void *) + (sizeof(t_real) << 8);
+	p[16] = sizeof(t_grid);
+	p[17] = GRID_MAX_RES + ((long)GRID_MAX_REFS << 16);
+	p[18] = GRID_DENSITY * 1000;
+	p[19] = GRID_HASH_CELL * 1000;
+	return (hash_bytes(hash, p, sizeof(p)));
+}
+
+/* cache_key()
+	Key of the cache of a scene: a hash of the bytes of its .rt file, of
+	the --accel kind and --build method and of the parameters above. A
+	cache made of another version of the file, or by another build of
+	miniRT, has another key.
+	Return the key, 0 if the scene file can't be read
+*/
+unsigned long	cache_key(char *file, t_options *opt)
+{
+	unsigned char	buf[65536];
+	unsigned long	hash;
+	long			n;
+	int				fd;
+
+	fd = open(file, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	hash = 14695981039346656037UL;
+	n = read(fd, buf, sizeof(buf));
+	while (n > 0)
+	{
+		hash = hash_bytes(hash, buf, n);
+		n = read(fd, buf, sizeof(buf));
+	}
+	close(fd);
+	if (n < 0)
+		return (0);
+	return (hash_params(hash, opt));
+}
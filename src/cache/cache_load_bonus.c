@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_load_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:50:58 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/16 23:50:58 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static void	reloc_lights(char *base, t_light **lights)
+{
+	t_light	*light;
+
+	*lights = cache_reloc(base, *lights);
+	light = *lights;
+	while (light)
+	{
+		light->next = cache_reloc(base, light->next);
+		light = light->next;
+	}
+}
+
+// relocates everything the scene of the cache file points to
+static t_scene	*reloc_scene(char *base, t_cache_head *head)
+{
+	t_scene	*scene;
+	t_group	*group;
+
+	scene = (t_scene *)(base + head->scene);
+	reloc_lights(base, &scene->lights);
+	scene->groups = cache_reloc(base, scene->groups);
+	group = scene->groups;
+	while (group)
+	{
+		group->name = cache_reloc(base, group->name);
+		cache_reloc_accel(base, &group->objects, &group->accel);
+		group->next = cache_reloc(base, group->next);
+		group = group->next;
+	}
+	cache_reloc_accel(base, &scene->objects, &scene->accel);
+	return (scene);
+}
+
+/* cache_load()
+	Maps the cache file written by cache_save() and relocates its pointers.
+	The mapping is private: the pages written by the relocation (objects,
+	pointer arrays) are copied, those never written to (BVH nodes) are
+	shared with the page cache and only read from the disk when touched.
+	The scene lives in the mapping: free_scene() just unmaps it.
+	Return the scene, NULL if there is no cache or it doesn't match `key`
+*/
+t_scene	*cache_load(char *path, unsigned long key)
+{
+	struct stat		st;
+	t_cache_head	*head;
+	t_scene			*scene;
+	int				fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	head = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size >= (long)sizeof(t_cache_head))
+		head = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+				fd, 0);
+	close(fd);
+	if (head == MAP_FAILED)
+		return (NULL);
+	if (ft_memcmp(head->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0
+		|| head->key != key || head->size != st.st_size)
+		return (munmap(head, st.st_size), NULL);
+	scene = reloc_scene((char *)head, head);
+	scene->cache = head;
+	scene->cache_size = st.st_size;
+	return (scene);
+}
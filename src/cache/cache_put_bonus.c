@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_put_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:50:10 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:52:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* cache_put()
+	Appends `size` bytes to the cache being written, at an offset aligned
+	on CACHE_ALIGN bytes: a copy of `src`, or zeros if src is NULL.
+	Pointers into cb->data are only valid until the next cache_put().
+	Return the offset, 0 for nothing (size 0) or if an allocation failed:
+	cb->failed is then set, and the later writes land in the file head,
+	which is never saved.
+*/
+long	cache_put(t_cache_buf *cb, void *src, long size)
+{
+	long	off;
+	char	*data;
+
+	off = (cb->size + CACHE_ALIGN - 1) / CACHE_ALIGN * CACHE_ALIGN;
+	if (size <= 0 || cb->failed)
+		return (0);
+	if (off + size > cb->cap)
+	{
+		data = malloc(2 * (off + size));
+		cb->failed = (data == NULL);
+		if (!data)
+			return (0);
+		ft_memcpy(data, cb->data, cb->size);
+		free(cb->data);
+		cb->data = data;
+		cb->cap = 2 * (off + size);
+	}
+	ft_bzero(cb->data + cb->size, off + size - cb->size);
+	if (src)
+		ft_memcpy(cb->data + off, src, size);
+	cb->size = off + size;
+	return (off);
+}
+
+// offset of a group in the array written by put_groups()
+static long	group_offset(t_cache_buf *cb, t_group *group)
+{
+	t_group	*g;
+	long	i;
+
+	g = cb->group_list;
+	i = 0;
+	while (g && g != group)
+	{
+		g = g->next;
+		i++;
+	}
+	return (cb->groups + i * sizeof(t_group));
+}
+
+// writes the object's shape data, then its record at the offset `rec`
+static void	put_object(t_cache_buf *cb, t_object *obj, long rec, long next)
+{
+	long		shape;
+	long		size;
+	t_object	*o;
+
+	size = sizeof(t_sphere);
+	if (obj->type == PLANE)
+		size = sizeof(t_plane);
+	else if (obj->type == CYLINDER)
+		size = sizeof(t_cylinder);
+	else if (obj->type == CONE)
+		size = sizeof(t_cone);
+	else if (obj->type == INSTANCE)
+		size = sizeof(t_instance);
+	shape = cache_put(cb, obj->shape_data, size);
+	if (obj->type == INSTANCE)
+		((t_instance *)(cb->data + shape))->group = (t_group *)
+			group_offset(cb, ((t_instance *)obj->shape_data)->group);
+	o = (t_object *)(cb->data + rec);
+	*o = *obj;
+	o->shape_data = (void *)shape;
+	o->next = (t_object *)next;
+}
+
+/* put_objects()
+	Writes the objects of an accel as one array, acc->prims first, then the
+	planes, and links them in that order. The accel's prims and planes
+	arrays are then just pointers into it.
+	Return the offset of the array, the head of the new list
+*/
+static long	put_objects(t_cache_buf *cb, t_accel *acc)
+{
+	t_object	*obj;
+	long		objs;
+	long		next;
+	int			n;
+	int			i;
+
+	n = acc->prim_count + acc->plane_count;
+	objs = cache_put(cb, NULL, sizeof(t_object) * n);
+	i = -1;
+	while (++i < n)
+	{
+		if (i < acc->prim_count)
+			obj = acc->prims[i];
+		else
+			obj = acc->planes[i - acc->prim_count];
+		next = 0;
+		if (i + 1 < n)
+			next = objs + (i + 1) * sizeof(t_object);
+		put_object(cb, obj, objs + i * sizeof(t_object), next);
+	}
+	return (objs);
+}
+
+/* cache_put_accel()
+	Writes an accel, its objects and its arrays (the BVH nodes are copied
+	as they are, they hold no pointer), then its grid or its quantized BVH
+	if any, and its compiled primitives
+	Return the offset of the accel, *objects: that of its objects
+*/
+long	cache_put_accel(t_cache_buf *cb, t_accel *acc, long *objects)
+{
+	long	prims;
+	long	nodes;
+	long	wnodes;
+	long	off;
+	int		i;
+
+	*objects = put_objects(cb, acc);
+	prims = cache_put(cb, NULL, sizeof(t_object *)
+			* (acc->prim_count + acc->plane_count));
+	i = -1;
+	while (!cb->failed && ++i < acc->prim_count + acc->plane_count)
+		((long *)(cb->data + prims))[i] = *objects + i * sizeof(t_object);
+	nodes = cache_put(cb, acc->nodes, sizeof(t_bvh_node) * acc->node_count);
+	wnodes = cache_put(cb, acc->wnodes, sizeof(t_wbvh_node)
+			* acc->wnode_count);
+	off = cache_put(cb, NULL, sizeof(t_accel));
+	*(t_accel *)(cb->data + off) = (t_accel){.kind = acc->kind,
+		.prims = (t_object **)prims, .prim_count = acc->prim_count,
+		.planes = (t_object **)(prims + acc->prim_count * sizeof(void *)),
+		.plane_count = acc->plane_count, .nodes = (t_bvh_node *)nodes,
+		.node_count = acc->node_count, .wnodes = (t_wbvh_node *)wnodes,
+		.wnode_count = acc->wnode_count, .width = acc->width,
+		.build_ms = acc->build_ms, .build_threads = acc->build_threads};
+	cache_put_grid(cb, acc->grid, off);
+	return (cache_put_qbvh(cb, acc, cache_put_soa(cb, acc, off)));
+}
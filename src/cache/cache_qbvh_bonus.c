@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_qbvh_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:15:25 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:19:20 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* cache_put_qbvh()
+	Writes the quantized nodes of an accel (they hold no pointer) and links
+	them to the accel written at the offset `accel`, with their root box
+	Return `accel`
+*/
+long	cache_put_qbvh(t_cache_buf *cb, t_accel *acc, long accel)
+{
+	t_accel	*rec;
+	long	qnodes;
+
+	if (!acc->qnodes)
+		return (accel);
+	qnodes = cache_put(cb, acc->qnodes, (long)acc->qnode_count
+			* qbvh_node_size(acc->qbits));
+	if (cb->failed)
+		return (accel);
+	rec = (t_accel *)(cb->data + accel);
+	rec->qnodes = (char *)qnodes;
+	rec->qnode_count = acc->qnode_count;
+	rec->qbits = acc->qbits;
+	rec->qroot = acc->qroot;
+	return (accel);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_reloc_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:51:18 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:52:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// a pointer of the cache file (an offset from its start) made absolute
+void	*cache_reloc(char *base, void *off)
+{
+	if (!off)
+		return (NULL);
+	return (base + (long)off);
+}
+
+static void	reloc_objects(char *base, t_object *obj)
+{
+	t_instance	*in;
+
+	while (obj)
+	{
+		obj->shape_data = cache_reloc(base, obj->shape_data);
+		if (obj->type == INSTANCE)
+		{
+			in = obj->shape_data;
+			in->group = cache_reloc(base, in->group);
+		}
+		obj->next = cache_reloc(base, obj->next);
+		obj = obj->next;
+	}
+}
+
+/* cache_reloc_accel()
+	Relocates a list of objects and the accel built over them: its arrays,
+	the object pointers in them and its compiled primitives. The wide nodes
+	may have been written on a machine without AVX, their box test is
+	picked again for this one.
+*/
+void	cache_reloc_accel(char *base, t_object **objects, t_accel **accel)
+{
+	t_accel	*acc;
+	int		i;
+
+	*objects = cache_reloc(base, *objects);
+	reloc_objects(base, *objects);
+	*accel = cache_reloc(base, *accel);
+	acc = *accel;
+	acc->prims = cache_reloc(base, acc->prims);
+	acc->planes = cache_reloc(base, acc->planes);
+	acc->nodes = cache_reloc(base, acc->nodes);
+	acc->wnodes = cache_reloc(base, acc->wnodes);
+	acc->qnodes = cache_reloc(base, acc->qnodes);
+	cache_reloc_grid(base, &acc->grid);
+	cache_reloc_soa(base, &acc->soa);
+	i = -1;
+	while (++i < acc->prim_count)
+		acc->prims[i] = cache_reloc(base, acc->prims[i]);
+	i = -1;
+	while (++i < acc->plane_count)
+		acc->planes[i] = cache_reloc(base, acc->planes[i]);
+	if (acc->width)
+		acc->simd = wbvh_simd_level(acc->width);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_save_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:50:31 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:29:34 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the lights, as an array linked in the order of the list
+static long	put_lights(t_cache_buf *cb, t_light *light)
+{
+	long	first;
+	long	prev;
+	long	off;
+
+	first = 0;
+	prev = 0;
+	while (light)
+	{
+		off = cache_put(cb, light, sizeof(t_light));
+		((t_light *)(cb->data + off))->next = NULL;
+		if (prev)
+			((t_light *)(cb->data + prev))->next = (t_light *)off;
+		else
+			first = off;
+		prev = off;
+		light = light->next;
+	}
+	return (first);
+}
+
+static int	group_count(t_group *group)
+{
+	int	n;
+
+	n = 0;
+	while (group)
+	{
+		group = group->next;
+		n++;
+	}
+	return (n);
+}
+
+/* put_groups()
+	Writes the groups as an array, in the order of their list, then their
+	names, objects and accels. The array comes first: an instance of a
+	group (in a later group or in the scene) refers to it by its offset.
+	Return the offset of the array, 0 if there is no group
+*/
+static long	put_groups(t_cache_buf *cb, t_group *group)
+{
+	t_group	*g;
+	long	name;
+	long	accel;
+	long	objects;
+	int		i;
+
+	cb->group_list = group;
+	cb->groups = cache_put(cb, NULL, sizeof(t_group) * group_count(group));
+	i = 0;
+	while (group)
+	{
+		name = cache_put(cb, group->name, ft_strlen(group->name) + 1);
+		accel = cache_put_accel(cb, group->accel, &objects);
+		g = (t_group *)(cb->data + cb->groups) + i++;
+		*g = (t_group){(char *)name, (t_object *)objects, (t_accel *)accel,
+			group->bounds, NULL};
+		if (group->next)
+			g->next = (t_group *)(cb->groups + i * sizeof(t_group));
+		group = group->next;
+	}
+	return (cb->groups);
+}
+
+/* write_file()
+	Writes the cache to a temporary file of its own first (mkstemp()),
+	renamed once complete: two miniRT writing the same cache at once each
+	write their own file and the last rename wins, and one killed while
+	writing leaves its temporary file, never a truncated cache. The
+	temporary file is removed when anything fails.
+	Return 1 on success, 0 on failure
+*/
+static int	write_file(t_cache_buf *cb, char *path)
+{
+	char	*tmp;
+	long	done;
+	long	n;
+	int		fd;
+
+	tmp = ft_strjoin(path, ".XXXXXX");
+	if (!tmp)
+		return (0);
+	fd = mkstemp(tmp);
+	if (fd < 0)
+		return (free(tmp), 0);
+	fchmod(fd, 0644);
+	done = 0;
+	n = 1;
+	while (done < cb->size && n > 0)
+	{
+		n = write(fd, cb->data + done, cb->size - done);
+		done += n;
+	}
+	close(fd);
+	if (done != cb->size || rename(tmp, path) != 0)
+		return (unlink(tmp), free(tmp), 0);
+	free(tmp);
+	return (1);
+}
+
+/* cache_save()
+	Writes the parsed scene and its accels to the cache file `path`, for
+	cache_load() to map them back. The scene is not changed.
+	The objects of each list are written in the order of their accel,
+	which is the order the renderer knows them in.
+	Return 1 on success, 0 on failure
+*/
+int	cache_save(t_scene *scene, char *path, unsigned long key)
+{
+	t_cache_buf		cb;
+	t_scene			*s;
+	long			off[5];
+	int				ok;
+
+	cb = (t_cache_buf){malloc(1 << 20), sizeof(t_cache_head), 1 << 20,
+		NULL, 0, 0};
+	if (!cb.data)
+		return (0);
+	off[0] = put_groups(&cb, scene->groups);
+	off[1] = cache_put_accel(&cb, scene->accel, &off[2]);
+	off[3] = put_lights(&cb, scene->lights);
+	off[4] = cache_put(&cb, scene, sizeof(t_scene));
+	s = (t_scene *)(cb.data + off[4]);
+	s->groups = (t_group *)off[0];
+	s->accel = (t_accel *)off[1];
+	s->objects = (t_object *)off[2];
+	s->lights = (t_light *)off[3];
+	*(t_cache_head *)cb.data = (t_cache_head){CACHE_MAGIC, key, cb.size,
+		off[4]};
+	ok = !cb.failed && write_file(&cb, path);
+	free(cb.data);
+	return (ok);
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_soa_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:38:29 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 01:50:09 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* cache_put_soa()
+	Writes the compiled primitives of an accel (they hold no pointer but
+	those to their own arrays) and links them to the accel written at the
+	offset `accel`, with their counts
+	Return `accel`
+*/
+long	cache_put_soa(t_cache_buf *cb, t_accel *acc, long accel)
+{
+	t_prim_soa	*s;
+	t_prim_soa	rec;
+
+	s = &acc->soa;
+	rec = *s;
+	rec.type = (unsigned char *)cache_put(cb, s->type, sizeof(unsigned char)
+			* s->total);
+	rec.slot = (int *)cache_put(cb, s->slot, sizeof(int) * s->total);
+	rec.mat = (t_material *)cache_put(cb, s->mat, sizeof(t_material)
+			* s->total);
+	rec.block = (double *)cache_put(cb, s->block, sizeof(double)
+			* prim_soa_doubles(s));
+	if (!cb->failed)
+		((t_accel *)(cb->data + accel))->soa = rec;
+	return (accel);
+}
+
+// the compiled primitives of an accel loaded from the cache: their arrays
+// are relocated, those of each type carved again out of the block, and the
+// sphere kernels picked for this CPU, not the one that wrote the cache
+void	cache_reloc_soa(char *base, t_prim_soa *s)
+{
+	s->type = cache_reloc(base, s->type);
+	s->slot = cache_reloc(base, s->slot);
+	s->mat = cache_reloc(base, s->mat);
+	s->block = cache_reloc(base, s->block);
+	prim_soa_carve(s);
+	s->simd = kernel_simd_level();
+}
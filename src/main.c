@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/02 10:35:00 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/07 14:10:51 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/16 22:59:37 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,10 +15,13 @@
 int	main(int argc, char **argv)
 {
 	t_program_data	*data;
+	t_options		opt;
 
 	if (argc != 2)
 		return (error_msg("Usage: ./miniRT <scene.rt>"), 1);
-	data = init_program_data(argv[1]);
+	opt = (t_options){0};
+	opt.scene_file = argv[1];
+	data = init_program_data(&opt);
 	if (!data)
 		return (1);
 	render(data->scene, data->mlx);
@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:59:56 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:59:23 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+int	main(int argc, char **argv)
+{
+	t_program_data	*data;
+	t_options		opt;
+
+	if (!parse_options(argc, argv, &opt))
+		return (error_msg("Usage: ./miniRTbonus <scene.rt> "
+				"[--accel linear|bvh|bvh4|bvh8|grid|hgrid|qbvh8|qbvh16] "
+				"[--build sah|lbvh|lbvh-opt] [--bench] [--size WxH] "
+				"[--animate N] [--stride K] [--no-cache] "
+				"[--ppm FILE] [--diff FILE] [--packet 1|2|4|8] "
+				"[--threads N]"), 1);
+	data = init_program_data(&opt);
+	if (!data)
+		return (1);
+	if (opt.animate)
+		run_animation(data);
+	else if (opt.bench)
+		run_bench(data);
+	if (opt.bench)
+		return (cleanup(data));
+	setup_hooks(data);
+	render_progressive(data);
+	mlx_loop(data->mlx->mlx_ptr);
+	return (0);
+}
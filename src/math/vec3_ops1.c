@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/02 19:30:27 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/04 19:27:52 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -44,7 +44,7 @@ t_vec3	vec3_sub(t_vec3 v1, t_vec3 v2)
 	Multiplies a vector by a scalar value t
 	v_new = v * t
 */
-t_vec3	vec3_mul(t_vec3 v, double t)
+t_vec3	vec3_mul(t_vec3 v, t_real t)
 {
 	t_vec3	result;
 
@@ -59,7 +59,7 @@ t_vec3	vec3_mul(t_vec3 v, double t)
 	Handles division by zero by returning a zero vector.
 	v_new = v / t
 */
-t_vec3	vec3_div(t_vec3 v, double t)
+t_vec3	vec3_div(t_vec3 v, t_real t)
 {
 	t_vec3	result;
 
@@ -73,12 +73,12 @@ t_vec3	vec3_div(t_vec3 v, double t)
 
 /* vec3_dot()
 	Computes the dot product of two vectors.
-	The result is a scalar value (double).
+	The result is a scalar value (t_real).
 	dot = v1 . v2
 */
-double	vec3_dot(t_vec3 v1, t_vec3 v2)
+t_real	vec3_dot(t_vec3 v1, t_vec3 v2)
 {
-	double	result;
+	t_real	result;
 
 	result = v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
 	return (result);
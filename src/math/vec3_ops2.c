@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/02 19:51:42 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/08 16:12:44 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,9 +16,9 @@
 	Returns the squared length of vector v.
 	Useful for performance optimization when comparing lengths.
 */
-double	vec3_length_squared(t_vec3 v)
+t_real	vec3_length_squared(t_vec3 v)
 {
-	double	result;
+	t_real	result;
 
 	result = v.x * v.x + v.y * v.y + v.z * v.z;
 	return (result);
@@ -27,9 +27,9 @@ double	vec3_length_squared(t_vec3 v)
 /* vec3_length(t_vec3 v)
 	Returns the length (magnitude) of vector v.
 */
-double	vec3_length(t_vec3 v)
+t_real	vec3_length(t_vec3 v)
 {
-	double	len_sq;
+	t_real	len_sq;
 
 	len_sq = vec3_length_squared(v);
 	return (sqrt(len_sq));
@@ -41,7 +41,7 @@ double	vec3_length(t_vec3 v)
 */
 t_vec3	vec3_normalize(t_vec3 v)
 {
-	double	len;
+	t_real	len;
 
 	len = vec3_length(v);
 	if (len == 0.0)
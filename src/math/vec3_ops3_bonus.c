@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/09 15:07:09 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/09 15:20:35 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,10 +24,40 @@
 */
 t_vec3	vec3_reflect(t_vec3 in, t_vec3 n)
 {
-	double	dot_product;
+	t_real	dot_product;
 	t_vec3	scaled_normal;
 
 	dot_product = 2 * vec3_dot(in, n);
 	scaled_normal = vec3_mul(n, dot_product);
 	return (vec3_sub(in, scaled_normal));
 }
+
+/* vec3_axis()
+	Returns the component of `v` along `axis` (0: x, 1: y, 2: z), for
+	code that loops over the three axes
+*/
+t_real	vec3_axis(t_vec3 v, int axis)
+{
+	if (axis == 0)
+		return (v.x);
+	if (axis == 1)
+		return (v.y);
+	return (v.z);
+}
+
+/* vec3_rotate()
+	Rotates `v` around the unit axis `k` (Rodrigues' rotation formula):
+		v * cos + (k x v) * sin + k * (k . v) * (1 - cos)
+	Input:
+		v:		the vector to rotate
+		k:		the rotation axis, normalized
+		cos_a:	cosine of the rotation angle
+		sin_a:	sine of the rotation angle
+*/
+t_vec3	vec3_rotate(t_vec3 v, t_vec3 k, t_real cos_a, t_real sin_a)
+{
+	t_vec3	r;
+
+	r = vec3_add(vec3_mul(v, cos_a), vec3_mul(vec3_cross(k, v), sin_a));
+	return (vec3_add(r, vec3_mul(k, vec3_dot(k, v) * (1.0 - cos_a))));
+}
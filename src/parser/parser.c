@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/01 14:53:51 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/08 13:48:04 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 03:13:29 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -54,6 +54,14 @@ void	init_scene(t_scene *scene)
 	scene->has_camera = 0;
 	scene->lights = NULL;
 	scene->objects = NULL;
+	scene->accel = NULL;
+	scene->groups = NULL;
+	scene->cur_group = NULL;
+	scene->cache = NULL;
+	scene->cache_size = 0;
+	scene->packet = 1;
+	scene->threads = 1;
+	scene->pool = NULL;
 }
 
 // Reads the file line by line and calls parser for each line
@@ -81,6 +89,7 @@ int	read_and_parse_file(int fd, t_scene *scene)
 
 // Main entry point for parsing a scene file
 // On read_and_parse_file error: free allocated scene and its contents
+// The shapes then get their derived quantities (see shape_prepare())
 t_scene	*parse_scene(const char *filename)
 {
 	int		fd;
@@ -104,6 +113,7 @@ t_scene	*parse_scene(const char *filename)
 		free_scene(scene);
 		return (error_msg("Scene must have Camera and Ambient light"), NULL);
 	}
+	shapes_prepare(scene->objects);
 	return (scene);
 }
 
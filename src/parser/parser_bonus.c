@@ -6,12 +6,32 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/01 14:53:51 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/13 14:26:29 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 03:13:29 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
+// Dispatcher for the objects and the group elements (G, E, I)
+static int	parse_object_line(char **tokens, t_scene *scene)
+{
+	if (ft_strcmp(tokens[0], "sp") == 0)
+		return (parse_sphere(tokens, scene));
+	if (ft_strcmp(tokens[0], "pl") == 0)
+		return (parse_plane(tokens, scene));
+	if (ft_strcmp(tokens[0], "cy") == 0)
+		return (parse_cylinder(tokens, scene));
+	if (ft_strcmp(tokens[0], "co") == 0)
+		return (parse_cone(tokens, scene));
+	if (ft_strcmp(tokens[0], "G") == 0)
+		return (parse_group(tokens, scene));
+	if (ft_strcmp(tokens[0], "E") == 0)
+		return (parse_group_end(tokens, scene));
+	if (ft_strcmp(tokens[0], "I") == 0)
+		return (parse_instance(tokens, scene));
+	return (error_msg("Unknown element identifier"));
+}
+
 // Dispatcher to call the correct parser based on the element identifier
 int	parse_line(char *line, t_scene *scene)
 {
@@ -27,16 +47,8 @@ int	parse_line(char *line, t_scene *scene)
 		result = parse_camera(tokens, scene);
 	else if (ft_strcmp(tokens[0], "L") == 0)
 		result = parse_light(tokens, scene);
-	else if (ft_strcmp(tokens[0], "sp") == 0)
-		result = parse_sphere(tokens, scene);
-	else if (ft_strcmp(tokens[0], "pl") == 0)
-		result = parse_plane(tokens, scene);
-	else if (ft_strcmp(tokens[0], "cy") == 0)
-		result = parse_cylinder(tokens, scene);
-	else if (ft_strcmp(tokens[0], "co") == 0)
-		result = parse_cone(tokens, scene);
 	else
-		result = error_msg("Unknown element identifier");
+		result = parse_object_line(tokens, scene);
 	free_tokens(tokens);
 	return (result);
 }
@@ -53,6 +65,15 @@ void	init_scene(t_scene *scene)
 	scene->has_camera = 0;
 	scene->lights = NULL;
 	scene->objects = NULL;
+	scene->accel = NULL;
+	scene->groups = NULL;
+	scene->cur_group = NULL;
+	scene->light_soa = (t_light_soa){0};
+	scene->cache = NULL;
+	scene->cache_size = 0;
+	scene->packet = 1;
+	scene->threads = 1;
+	scene->pool = NULL;
 }
 
 // Reads the file line by line and calls parser for each line
@@ -75,6 +96,8 @@ int	read_and_parse_file(int fd, t_scene *scene)
 		free(line);
 		line = get_next_line(fd);
 	}
+	if (status && scene->cur_group)
+		return (error_msg("Group: missing `E` at the end of the group"));
 	return (status);
 }
 
@@ -105,31 +128,3 @@ t_scene	*parse_scene(const char *filename)
 	}
 	return (scene);
 }
-
-// frees all allocated memory in the scene struct including linked lists
-void	free_scene(t_scene *scene)
-{
-	t_light		*light;
-	t_light		*next_light;
-	t_object	*object;
-	t_object	*next_object;
-
-	if (!scene)
-		return ;
-	light = scene->lights;
-	while (light)
-	{
-		next_light = light->next;
-		free(light);
-		light = next_light;
-	}
-	object = scene->objects;
-	while (object)
-	{
-		next_object = object->next;
-		free(object->shape_data);
-		free(object);
-		object = next_object;
-	}
-	free(scene);
-}
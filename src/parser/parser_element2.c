@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/02 14:26:45 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/16 10:35:16 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,9 +57,9 @@ int	parse_cylinder(char **tokens, t_scene *scene)
 		return (obj_err("Cylinder: invalid center coordinates", obj, cy));
 	if (!parse_vec3(tokens[2], &cy->axis, 1) || !validate_norm_vec3(cy->axis))
 		return (obj_err("Cylinder: invalid orientation vector", obj, cy));
-	if (!parse_double(tokens[3], &cy->diameter) || cy->diameter <= 0.0)
+	if (!parse_real(tokens[3], &cy->diameter) || cy->diameter <= 0.0)
 		return (obj_err("Cylinder: invalid diameter", obj, cy));
-	if (!parse_double(tokens[4], &cy->height) || cy->height <= 0.0)
+	if (!parse_real(tokens[4], &cy->height) || cy->height <= 0.0)
 		return (obj_err("Cylinder: invalid height", obj, cy));
 	if (!parse_color(tokens[5], &obj->color))
 		return (obj_err("Cylinder: invalid color format", obj, cy));
@@ -6,13 +6,14 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/02 14:26:45 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/16 11:05:26 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
 // Parses Plane: pl <x,y,z> <nx,ny,nz> <R,G,B> <specular> <shine>
+// planes are unbounded, they can't go into a group (nor into a BVH)
 int	parse_plane(char **tokens, t_scene *scene)
 {
 	t_object	*obj;
@@ -20,6 +21,8 @@ int	parse_plane(char **tokens, t_scene *scene)
 
 	if (count_tokens(tokens) < 6)
 		return (error_msg("Plane: bonus part requires 5+ parameters"));
+	if (scene->cur_group)
+		return (error_msg("Plane: infinite planes can't be part of a group"));
 	obj = malloc(sizeof(t_object));
 	pl = malloc(sizeof(t_plane));
 	if (!obj || !pl)
@@ -58,18 +61,16 @@ int	parse_cylinder(char **tokens, t_scene *scene)
 		return (obj_err("Cylinder: invalid center coordinates", obj, cy));
 	if (!parse_vec3(tokens[2], &cy->axis, 1) || !validate_norm_vec3(cy->axis))
 		return (obj_err("Cylinder: invalid axis orientation vector", obj, cy));
-	if (!parse_double(tokens[3], &cy->diameter) || cy->diameter <= 0.0)
+	if (!parse_real(tokens[3], &cy->diameter) || cy->diameter <= 0.0)
 		return (obj_err("Cylinder: diameter should be > 0", obj, cy));
-	if (!parse_double(tokens[4], &cy->height) || cy->height <= 0.0)
+	if (!parse_real(tokens[4], &cy->height) || cy->height <= 0.0)
 		return (obj_err("Cylinder: height should be > 0", obj, cy));
 	if (!set_material(obj, tokens, 5))
 		return (obj_err("Cylinder: `set_material()` error", obj, cy));
 	cy->center = vec3_sub(cy->center, vec3_mul(cy->axis, cy->height / 2.0));
 	obj->type = CYLINDER;
 	obj->shape_data = cy;
-	obj->next = scene->objects;
-	scene->objects = obj;
-	return (1);
+	return (add_object(scene, obj));
 }
 
 // Parses Cone: co [tip_xyz] [axis_xyz] [half_angle_deg] [height]
@@ -92,15 +93,13 @@ int	parse_cone(char **tokens, t_scene *scene)
 		return (obj_err("Cone: invalid tip coordinates", obj, co));
 	if (!parse_vec3(tokens[2], &co->axis, 1) || !validate_norm_vec3(co->axis))
 		return (obj_err("Cone: invalid axis orientation vector", obj, co));
-	if (!parse_double(tokens[3], &co->angle) || !validate_angle(co))
+	if (!parse_real(tokens[3], &co->angle) || !validate_angle(co))
 		return (obj_err("Cone: invalid angle", obj, co));
-	if (!parse_double(tokens[4], &co->height) || co->height <= 0.0)
+	if (!parse_real(tokens[4], &co->height) || co->height <= 0.0)
 		return (obj_err("Cone: height should be > 0", obj, co));
 	if (!set_material(obj, tokens, 5))
 		return (obj_err("Cone: `set_material()` error", obj, co));
 	obj->type = CONE;
 	obj->shape_data = co;
-	obj->next = scene->objects;
-	scene->objects = obj;
-	return (1);
+	return (add_object(scene, obj));
 }
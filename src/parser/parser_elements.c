@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/01 13:24:03 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/16 11:00:02 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,14 +15,14 @@
 // Parses Ambient light: A <ratio> <R,G,B>
 int	parse_ambient(char **tokens, t_scene *scene)
 {
-	double	ratio;
+	t_real	ratio;
 	t_color	color;
 
 	if (count_tokens(tokens) < 3)
 		return (error_msg("Ambient light: requires 2 parameters"));
 	if (scene->has_ambient)
 		return (error_msg("Ambient light: declared more than once"));
-	if (!parse_double(tokens[1], &ratio) || !validate_ratio(ratio))
+	if (!parse_real(tokens[1], &ratio) || !validate_ratio(ratio))
 		return (error_msg("Ambient light: invalid ratio"));
 	if (!parse_color(tokens[2], &color))
 		return (error_msg("Ambient light: invalid color format"));
@@ -37,7 +37,7 @@ int	parse_camera(char **tokens, t_scene *scene)
 {
 	t_point3	origin;
 	t_vec3		orientation;
-	double		fov;
+	t_real		fov;
 
 	if (count_tokens(tokens) < 4)
 		return (error_msg("Camera: requires 3 parameters"));
@@ -48,7 +48,7 @@ int	parse_camera(char **tokens, t_scene *scene)
 	if (!parse_vec3(tokens[2], &orientation, 1)
 		|| !validate_norm_vec3(orientation))
 		return (error_msg("Camera: invalid orientation vector"));
-	if (!parse_double(tokens[3], &fov) || !validate_fov(fov))
+	if (!parse_real(tokens[3], &fov) || !validate_fov(fov))
 		return (error_msg("Camera: invalid FOV"));
 	scene->camera.origin = origin;
 	scene->camera.orientation = orientation;
@@ -66,7 +66,7 @@ int	parse_light(char **tokens, t_scene *scene)
 {
 	t_light		*light;
 	t_point3	pos;
-	double		ratio;
+	t_real		ratio;
 
 	if (count_tokens(tokens) < 3)
 		return (error_msg("Light: requires 2 parameters"));
@@ -75,7 +75,7 @@ int	parse_light(char **tokens, t_scene *scene)
 		return (error_msg("Light: memory allocation failed"));
 	if (!parse_vec3(tokens[1], &pos, 0))
 		return (light_err("Light: invalid position coordinates", light));
-	if (!parse_double(tokens[2], &ratio) || !validate_ratio(ratio))
+	if (!parse_real(tokens[2], &ratio) || !validate_ratio(ratio))
 		return (light_err("Light: invalid brightness ratio", light));
 	light->position = pos;
 	light->ratio = ratio;
@@ -98,7 +98,7 @@ int	parse_sphere(char **tokens, t_scene *scene)
 		return (obj_err("Sphere: memory allocation failed", obj, sp));
 	if (!parse_vec3(tokens[1], &sp->center, 0))
 		return (obj_err("Sphere: invalid center coordinates", obj, sp));
-	if (!parse_double(tokens[2], &sp->radius) || sp->radius <= 0)
+	if (!parse_real(tokens[2], &sp->radius) || sp->radius <= 0)
 		return (obj_err("Sphere: invalid diameter", obj, sp));
 	sp->radius /= 2.0;
 	if (!parse_color(tokens[3], &obj->color))
@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/01 13:24:03 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/16 11:01:58 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,14 +15,14 @@
 // Parses Ambient light: A <ratio> <R,G,B>
 int	parse_ambient(char **tokens, t_scene *scene)
 {
-	double	ratio;
+	t_real	ratio;
 	t_color	color;
 
 	if (count_tokens(tokens) < 3)
 		return (error_msg("Ambient light: requires 2 parameters"));
 	if (scene->has_ambient)
 		return (error_msg("Ambient light: declared more than once"));
-	if (!parse_double(tokens[1], &ratio) || !validate_ratio(ratio))
+	if (!parse_real(tokens[1], &ratio) || !validate_ratio(ratio))
 		return (error_msg("Ambient light: invalid ratio"));
 	if (!parse_color(tokens[2], &color))
 		return (error_msg("Ambient light: invalid color format"));
@@ -37,7 +37,7 @@ int	parse_camera(char **tokens, t_scene *scene)
 {
 	t_point3	origin;
 	t_vec3		orientation;
-	double		fov;
+	t_real		fov;
 
 	if (count_tokens(tokens) < 4)
 		return (error_msg("Camera: requires 3 parameters"));
@@ -48,7 +48,7 @@ int	parse_camera(char **tokens, t_scene *scene)
 	if (!parse_vec3(tokens[2], &orientation, 1)
 		|| !validate_norm_vec3(orientation))
 		return (error_msg("Camera: invalid orientation vector"));
-	if (!parse_double(tokens[3], &fov) || !validate_fov(fov))
+	if (!parse_real(tokens[3], &fov) || !validate_fov(fov))
 		return (error_msg("Camera: invalid FOV"));
 	scene->camera.origin = origin;
 	scene->camera.orientation = orientation;
@@ -62,7 +62,7 @@ int	parse_light(char **tokens, t_scene *scene)
 {
 	t_light		*light;
 	t_point3	pos;
-	double		ratio;
+	t_real		ratio;
 	t_color		color;
 
 	if (count_tokens(tokens) < 4)
@@ -72,7 +72,7 @@ int	parse_light(char **tokens, t_scene *scene)
 		return (error_msg("Light: memory allocation failed"));
 	if (!parse_vec3(tokens[1], &pos, 0))
 		return (light_err("Light: invalid position coordinates", light));
-	if (!parse_double(tokens[2], &ratio) || !validate_ratio(ratio))
+	if (!parse_real(tokens[2], &ratio) || !validate_ratio(ratio))
 		return (light_err("Light: invalid brightness ratio", light));
 	if (!parse_color(tokens[3], &color))
 		return (light_err("Light: invalid color format", light));
@@ -91,9 +91,9 @@ int	set_material(t_object *obj, char **tokens, int i)
 	set_default_material(obj);
 	if (!parse_color(tokens[i++], &obj->color))
 		return (error_msg("Invalid color format"));
-	if (!parse_double(tokens[i++], &obj->speci) || !validate_ratio(obj->speci))
+	if (!parse_real(tokens[i++], &obj->speci) || !validate_ratio(obj->speci))
 		return (error_msg("Specular intensity must be in [0,1]"));
-	if (!parse_double(tokens[i++], &obj->shine) || obj->shine < 1.0)
+	if (!parse_real(tokens[i++], &obj->shine) || obj->shine < 1.0)
 		return (error_msg("Shininess must be >= 1.0"));
 	if (!parse_int(tokens[i++], &obj->checker) || !obj->checker)
 		return (1);
@@ -101,13 +101,13 @@ int	set_material(t_object *obj, char **tokens, int i)
 	{
 		if (!parse_color(tokens[i++], &obj->color2))
 			return (error_msg("Invalid 2nd color format"));
-		if (!parse_double(tokens[i], &obj->pattern_scale)
+		if (!parse_real(tokens[i], &obj->pattern_scale)
 			|| obj->pattern_scale <= 0)
 			return (error_msg("Pattern scale should be > 0"));
 	}
 	else if (obj->checker == MIRROR)
 	{
-		if (!parse_double(tokens[i++], &obj->reflect)
+		if (!parse_real(tokens[i++], &obj->reflect)
 			|| !validate_ratio(obj->reflect))
 			return (error_msg("Reflectivity must be in [0,1]"));
 	}
@@ -128,14 +128,12 @@ int	parse_sphere(char **tokens, t_scene *scene)
 		return (obj_err("Sphere: memory allocation failed", obj, sp));
 	if (!parse_vec3(tokens[1], &sp->center, 0))
 		return (obj_err("Sphere: invalid center coordinates", obj, sp));
-	if (!parse_double(tokens[2], &sp->radius) || sp->radius <= 0)
+	if (!parse_real(tokens[2], &sp->radius) || sp->radius <= 0)
 		return (obj_err("Sphere: invalid diameter", obj, sp));
 	if (!set_material(obj, tokens, 3))
 		return (obj_err("Sphere: `set_material()` error", obj, sp));
 	sp->radius /= 2.0;
 	obj->type = SPHERE;
 	obj->shape_data = sp;
-	obj->next = scene->objects;
-	scene->objects = obj;
-	return (1);
+	return (add_object(scene, obj));
 }
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_free_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:15:18 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 00:59:01 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// frees a linked list of objects and their shape data
+// (an instance's shape data doesn't own its group)
+void	free_objects(t_object *obj)
+{
+	t_object	*next;
+
+	while (obj)
+	{
+		next = obj->next;
+		free(obj->shape_data);
+		free(obj);
+		obj = next;
+	}
+}
+
+// frees a linked list of groups: their name, objects and accel
+void	free_groups(t_group *group)
+{
+	t_group	*next;
+
+	while (group)
+	{
+		next = group->next;
+		free(group->name);
+		free_objects(group->objects);
+		accel_free(group->accel);
+		free(group);
+		group = next;
+	}
+}
+
+// frees all allocated memory in the scene struct including linked lists
+// (a scene loaded from the cache is all in the mapping of the cache file)
+void	free_scene(t_scene *scene)
+{
+	t_light		*light;
+	t_light		*next_light;
+
+	if (!scene)
+		return ;
+	light_soa_free(&scene->light_soa);
+	if (scene->cache)
+	{
+		munmap(scene->cache, scene->cache_size);
+		return ;
+	}
+	light = scene->lights;
+	while (light)
+	{
+		next_light = light->next;
+		free(light);
+		light = next_light;
+	}
+	free_objects(scene->objects);
+	free_groups(scene->groups);
+	free_groups(scene->cur_group);
+	accel_free(scene->accel);
+	free(scene);
+}
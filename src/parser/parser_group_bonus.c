@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_group_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:15:18 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// adds a parsed object to the scene, or to the group being defined
+int	add_object(t_scene *scene, t_object *obj)
+{
+	if (scene->cur_group)
+	{
+		obj->next = scene->cur_group->objects;
+		scene->cur_group->objects = obj;
+	}
+	else
+	{
+		obj->next = scene->objects;
+		scene->objects = obj;
+	}
+	return (1);
+}
+
+// looks up a (fully parsed) group by name, NULL if there is none
+static t_group	*find_group(t_scene *scene, char *name)
+{
+	t_group	*group;
+
+	group = scene->groups;
+	while (group && ft_strcmp(group->name, name) != 0)
+		group = group->next;
+	return (group);
+}
+
+// Parses Group: G <name>
+// the objects that follow, up to the next `E`, belong to the group
+int	parse_group(char **tokens, t_scene *scene)
+{
+	t_group	*group;
+
+	if (count_tokens(tokens) < 2)
+		return (error_msg("Group: requires a name"));
+	if (scene->cur_group)
+		return (error_msg("Group: groups can't be nested, missing `E`?"));
+	if (find_group(scene, tokens[1]))
+		return (error_msg("Group: name already defined"));
+	group = ft_calloc(1, sizeof(t_group));
+	if (!group)
+		return (error_msg("Group: memory allocation failed"));
+	group->name = ft_strdup(tokens[1]);
+	if (!group->name)
+		return (free(group), error_msg("Group: memory allocation failed"));
+	scene->cur_group = group;
+	return (1);
+}
+
+// Parses End of group: E
+// from now on the group can be instantiated
+int	parse_group_end(char **tokens, t_scene *scene)
+{
+	(void)tokens;
+	if (!scene->cur_group)
+		return (error_msg("Group end: no group was started"));
+	if (!scene->cur_group->objects)
+		return (error_msg("Group end: the group is empty"));
+	scene->cur_group->next = scene->groups;
+	scene->groups = scene->cur_group;
+	scene->cur_group = NULL;
+	return (1);
+}
+
+// Parses Instance: I <group name> <x,y,z> <nx,ny,nz> <scale>
+// places the group at x,y,z, its y axis turned towards nx,ny,nz
+// the material of the instance is the one of the group's objects
+int	parse_instance(char **tokens, t_scene *scene)
+{
+	t_object	*obj;
+	t_instance	*in;
+	t_point3	pos;
+	t_vec3		dir;
+	t_real		scale;
+
+	if (count_tokens(tokens) < 5)
+		return (error_msg("Instance: requires 4 parameters"));
+	obj = ft_calloc(1, sizeof(t_object));
+	in = malloc(sizeof(t_instance));
+	if (!obj || !in)
+		return (obj_err("Instance: memory allocation failed", obj, in));
+	in->group = find_group(scene, tokens[1]);
+	if (!in->group)
+		return (obj_err("Instance: unknown group", obj, in));
+	if (!parse_vec3(tokens[2], &pos, 0))
+		return (obj_err("Instance: invalid position coordinates", obj, in));
+	if (!parse_vec3(tokens[3], &dir, 1) || !validate_norm_vec3(dir))
+		return (obj_err("Instance: invalid orientation vector", obj, in));
+	if (!parse_real(tokens[4], &scale) || scale <= 0.0)
+		return (obj_err("Instance: scale should be > 0", obj, in));
+	instance_set_transform(in, pos, dir, scale);
+	obj->type = INSTANCE;
+	obj->shape_data = in;
+	return (add_object(scene, obj));
+}
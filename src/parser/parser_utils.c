@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/30 23:35:03 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/08 13:06:55 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -91,9 +91,9 @@ int	parse_vec3(char *str, t_vec3 *vec, int need_norm)
 	return (1);
 }
 
-// Parses a string into a double
+// Parses a string into a t_real (double, or float in the float build)
 // A more robust implementation could check for invalid characters
-int	parse_double(char *str, double *val)
+int	parse_real(char *str, t_real *val)
 {
 	*val = ft_atof(str);
 	return (1);
@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/30 23:35:03 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/15 13:04:19 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/16 23:19:00 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -39,7 +39,7 @@ char	**get_tokens(char *line)
 {
 	char	**tokens;
 
-	tokens = ft_splits(line, " \t\r\v\f");
+	tokens = ft_splits(line, " \t\n\r\v\f");
 	if (!tokens || !tokens[0])
 	{
 		free_tokens(tokens);
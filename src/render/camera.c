@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/03 10:52:00 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/07 15:35:17 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -56,7 +56,7 @@ void	setup_camera(t_camera *cam, int img_width, int img_height)
 	cam->u = vec3_normalize(vec3_cross(world_up, cam->w));
 	cam->v = vec3_cross(cam->w, cam->u);
 	cam->viewport_width = 2.0 * tan((cam->fov * M_PI / 180.0) / 2.0) * 1.0;
-	cam->viewport_height = cam->viewport_width * ((double)img_height
+	cam->viewport_height = cam->viewport_width * ((t_real)img_height
 			/ img_width);
 	cam->viewport_u = vec3_mul(cam->u, cam->viewport_width);
 	cam->viewport_v = vec3_mul(vec3_mul(cam->v, -1), cam->viewport_height);
@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/12 12:20:16 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/13 14:11:44 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -43,12 +43,12 @@ c = (oc · A)² - (oc · oc) * cos²(α)
 		height:	the cone's height
 	Return 1 if the hit is valid, 0 otherwise
 */
-static int	is_hit_in_bounds(double m, double height)
+static int	is_hit_in_bounds(t_real m, t_real height)
 {
 	return (m >= 0 && m <= height);
 }
 
-static void	set_cone_wall_hit(t_hit_info *info, double qt)
+static void	set_cone_wall_hit(t_hit_info *info, t_real qt)
 {
 	info->hit_t = qt;
 	info->part = HIT_WALL;
@@ -66,8 +66,8 @@ static int	intersect_cone_wall(t_cone *co, t_ray *r, t_hit_info *info)
 {
 	t_quadratic	q;
 	t_vec3		oc;
-	double		d_dot_a;
-	double		oc_dot_a;
+	t_real		d_dot_a;
+	t_real		oc_dot_a;
 
 	oc = vec3_sub(r->origin, co->tip);
 	d_dot_a = vec3_dot(r->direction, co->axis);
@@ -81,10 +81,10 @@ static int	intersect_cone_wall(t_cone *co, t_ray *r, t_hit_info *info)
 		return (0);
 	q.t1 = (-q.b - sqrt(q.discriminant)) / (2 * q.a);
 	q.t2 = (-q.b + sqrt(q.discriminant)) / (2 * q.a);
-	if (q.t1 > 0.001 && q.t1 < info->hit_t && is_hit_in_bounds(oc_dot_a + q.t1
+	if (q.t1 > HIT_EPS && q.t1 < info->hit_t && is_hit_in_bounds(oc_dot_a + q.t1
 			* d_dot_a, co->height))
 		set_cone_wall_hit(info, q.t1);
-	if (q.t2 > 0.001 && q.t2 < info->hit_t && is_hit_in_bounds(oc_dot_a + q.t2
+	if (q.t2 > HIT_EPS && q.t2 < info->hit_t && is_hit_in_bounds(oc_dot_a + q.t2
 			* d_dot_a, co->height))
 		set_cone_wall_hit(info, q.t2);
 	return (info->part == HIT_WALL);
@@ -108,27 +108,27 @@ static int	intersect_cone_wall(t_cone *co, t_ray *r, t_hit_info *info)
 		and the normal points along the axis.
 	2. Check for an intersection with the cap's plane. We only consider hits
 		that are closer than any previously found hit.
-	3. If plane hit, calculate the squared radius of the cap using a trig. eq:
+	3. If plane hit, compare with the squared radius of the cap, computed
+		once with the scene (see shape_prepare()) using a trig. eq:
 		radius² = height² * tan²(angle) = height² * (1/cos²(angle) - 1)
 	4. Check if the hit point is within the cap's circular boudary.
 	5. If hit within radius, update the hit_info struct
 */
 static int	intersect_cone_cap(t_cone *co, t_ray *r, t_hit_info *info,
-		double t_max)
+		t_real t_max)
 {
 	t_plane			cap;
 	t_hit_record	temp_rec;
-	double			radius_sq;
 
 	info->hit = 0;
 	info->hit_t = t_max;
 	info->part = HIT_NONE;
-	cap.point = vec3_add(co->tip, vec3_mul(co->axis, co->height));
+	cap.point = co->base;
 	cap.normal = co->axis;
 	if (hit_plane(&cap, r, info->hit_t, &temp_rec))
 	{
-		radius_sq = co->height * co->height * (1.0 / co->cos_angle_sq - 1.0);
-		if (vec3_length_squared(vec3_sub(temp_rec.p, cap.point)) <= radius_sq)
+		if (vec3_length_squared(vec3_sub(temp_rec.p, cap.point))
+			<= co->cap_r_sq)
 		{
 			info->hit_t = temp_rec.t;
 			info->t = temp_rec.t;
@@ -164,12 +164,11 @@ static int	intersect_cone_cap(t_cone *co, t_ray *r, t_hit_info *info,
 		- if HIT_CAP, the normal is the cone axis
 	6. Revert the normal direction to point towards the incoming ray
 */
-int	hit_cone(t_cone *co, t_ray *ray, double t_max, t_hit_record *rec)
+int	hit_cone(t_cone *co, t_ray *ray, t_real t_max, t_hit_record *rec)
 {
 	t_hit_info	info;
 	t_vec3		p_tip;
-	double		m;
-	double		k_inv_cos2;
+	t_real		m;
 
 	(void)intersect_cone_cap(co, ray, &info, t_max);
 	(void)intersect_cone_wall(co, ray, &info);
@@ -181,9 +180,8 @@ int	hit_cone(t_cone *co, t_ray *ray, double t_max, t_hit_record *rec)
 	{
 		p_tip = vec3_sub(rec->p, co->tip);
 		m = vec3_dot(p_tip, co->axis);
-		k_inv_cos2 = 1.0 / co->cos_angle_sq;
 		rec->normal = vec3_normalize(vec3_sub(p_tip, vec3_mul(co->axis, m
-						* k_inv_cos2)));
+						* co->inv_cos_sq)));
 	}
 	else if (info.part == HIT_CAP)
 		rec->normal = co->axis;
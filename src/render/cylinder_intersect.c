@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/05 17:19:51 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/12 12:35:24 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,7 +16,7 @@
 void	get_wall_normal(t_cylinder *cy, t_hit_info *info)
 {
 	t_vec3	oc;
-	double	m;
+	t_real	m;
 
 	oc = vec3_sub(info->p, cy->center);
 	m = vec3_dot(oc, cy->axis);
@@ -39,7 +39,7 @@ void	get_wall_normal(t_cylinder *cy, t_hit_info *info)
 int	check_wall_hit(t_cylinder *cy, t_ray *ray, t_hit_info *info)
 {
 	t_vec3	oc;
-	double	m;
+	t_real	m;
 
 	info->p = vec3_add(ray->origin, vec3_mul(ray->direction, info->t));
 	oc = vec3_sub(info->p, cy->center);
@@ -91,31 +91,36 @@ code:
 
 	c = (oc · oc) - (oc · A)² - r_cy²
 code:
-	qc = vec3_dot(oc, oc) - pow(vec3_dot(oc, cy->axis), 2) -
-								(cy->diameter / 2.0) * (cy->diameter / 2.0);
+	q.c = vec3_dot(oc, oc) - oc_dot_a * oc_dot_a - cy->radius_sq;
+
+r_cy² is computed once, with the scene (see shape_prepare()), and so are
+D · A and oc · A, once per ray.
 */
 int	intersect_cylinder_wall(t_cylinder *cy, t_ray *r, t_hit_info *info)
 {
 	t_quadratic	q;
 	t_vec3		oc;
+	t_real		d_dot_a;
+	t_real		oc_dot_a;
 
 	oc = vec3_sub(r->origin, cy->center);
-	q.a = vec3_dot(r->direction, r->direction) - pow(vec3_dot(r->direction,
-				cy->axis), 2);
-	q.b = 2 * (vec3_dot(r->direction, oc) - vec3_dot(r->direction, cy->axis)
-			* vec3_dot(oc, cy->axis));
-	q.c = vec3_dot(oc, oc) - pow(vec3_dot(oc, cy->axis), 2) - (cy->diameter
-			/ 2.0) * (cy->diameter / 2.0);
+	d_dot_a = vec3_dot(r->direction, cy->axis);
+	oc_dot_a = vec3_dot(oc, cy->axis);
+	q.a = vec3_dot(r->direction, r->direction) - d_dot_a * d_dot_a;
+	q.b = 2 * (vec3_dot(r->direction, oc) - d_dot_a * oc_dot_a);
+	q.c = vec3_dot(oc, oc) - oc_dot_a * oc_dot_a - cy->radius_sq;
 	q.discriminant = q.b * q.b - 4 * q.a * q.c;
 	if (q.discriminant < 0)
 		return (0);
 	q.t1 = (-q.b - sqrt(q.discriminant)) / (2 * q.a);
 	info->t = q.t1;
-	if (info->t > 0.001 && info->t < info->hit_t && check_wall_hit(cy, r, info))
+	if (info->t > HIT_EPS && info->t < info->hit_t
+		&& check_wall_hit(cy, r, info))
 		return (1);
 	q.t2 = (-q.b + sqrt(q.discriminant)) / (2 * q.a);
 	info->t = q.t2;
-	if (info->t > 0.001 && info->t < info->hit_t && check_wall_hit(cy, r, info))
+	if (info->t > HIT_EPS && info->t < info->hit_t
+		&& check_wall_hit(cy, r, info))
 		return (1);
 	return (0);
 }
@@ -191,12 +196,11 @@ int	intersect_cylinder_wall(t_cylinder *cy, t_ray *r, t_hit_info *info)
 int	check_single_cap(t_cylinder *cy, t_ray *r, t_hit_info *info, t_plane *cap)
 {
 	t_hit_record	temp_rec;
-	double			radius_sq;
 
-	radius_sq = pow(cy->diameter / 2.0, 2);
 	if (hit_plane(cap, r, info->hit_t, &temp_rec))
 	{
-		if (vec3_length_squared(vec3_sub(temp_rec.p, cap->point)) <= radius_sq)
+		if (vec3_length_squared(vec3_sub(temp_rec.p, cap->point))
+			<= cy->radius_sq)
 		{
 			info->hit_t = temp_rec.t;
 			info->t = temp_rec.t;
@@ -231,7 +235,7 @@ int	intersect_cylinder_caps(t_cylinder *cy, t_ray *r, t_hit_info *info)
 	cap.normal = vec3_mul(cy->axis, -1);
 	if (check_single_cap(cy, r, info, &cap))
 		hit_found = 1;
-	cap.point = vec3_add(cy->center, vec3_mul(cy->axis, cy->height));
+	cap.point = cy->top;
 	cap.normal = cy->axis;
 	if (check_single_cap(cy, r, info, &cap))
 		hit_found = 1;
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instance_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 23:15:18 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:45:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// rotates `v` from group space to scene space: R * v
+static t_vec3	to_scene(t_instance *in, t_vec3 v)
+{
+	return (vec3_add(vec3_add(vec3_mul(in->cx, v.x), vec3_mul(in->cy, v.y)),
+			vec3_mul(in->cz, v.z)));
+}
+
+// rotates `v` from scene space to group space: R^-1 * v = R^T * v
+static t_vec3	to_group(t_instance *in, t_vec3 v)
+{
+	return ((t_vec3){vec3_dot(in->cx, v), vec3_dot(in->cy, v),
+		vec3_dot(in->cz, v)});
+}
+
+/* instance_set_transform()
+	Sets up the placement of an instance
+	Input:
+		*in:	the instance
+		pos:	where the origin of the group lands in the scene
+		dir:	where the y axis of the group points to in the scene
+		scale:	uniform scale factor, > 0
+	R is the smallest rotation turning the y axis into `dir`: the rotation
+	around k = y x dir by the angle between them (x and z follow). If `dir`
+	is (anti)parallel to y there's no such k, R is then the identity or
+	the half turn around x.
+*/
+void	instance_set_transform(t_instance *in, t_point3 pos, t_vec3 dir,
+		t_real scale)
+{
+	t_vec3	k;
+	t_real	sin_a;
+
+	in->pos = pos;
+	in->scale = scale;
+	in->cy = vec3_normalize(dir);
+	in->cx = (t_vec3){1, 0, 0};
+	in->cz = (t_vec3){0, 0, 1};
+	k = vec3_cross((t_vec3){0, 1, 0}, in->cy);
+	sin_a = vec3_length(k);
+	if (sin_a < 1e-9)
+	{
+		if (in->cy.y < 0)
+			in->cz = (t_vec3){0, 0, -1};
+		return ;
+	}
+	k = vec3_div(k, sin_a);
+	in->cx = vec3_rotate(in->cx, k, in->cy.y, sin_a);
+	in->cz = vec3_rotate(in->cz, k, in->cy.y, sin_a);
+}
+
+// box of the instance in the scene: the box of its 8 transformed corners
+t_aabb	instance_bounds(t_instance *in)
+{
+	t_aabb	box;
+	t_aabb	b;
+	t_vec3	c;
+	int		i;
+
+	b = in->group->bounds;
+	box = aabb_empty();
+	i = -1;
+	while (++i < 8)
+	{
+		c = b.min;
+		if (i & 1)
+			c.x = b.max.x;
+		if (i & 2)
+			c.y = b.max.y;
+		if (i & 4)
+			c.z = b.max.z;
+		c = vec3_add(in->pos, vec3_mul(to_scene(in, c), in->scale));
+		box = aabb_union(box, (t_aabb){c, c});
+	}
+	return (box);
+}
+
+/* hit_instance()
+	Intersects the ray with the group of an instance
+	The ray is moved into group space, where the group's own acceleration
+	structure (the bottom level) is walked: the origin is moved, rotated
+	and scaled, the direction only rotated, so that it keeps its unit
+	length and distances along it are the scene ones divided by `scale`.
+	The hit found there is moved back into the scene: material and
+	patterns are the ones of the group's object that was hit.
+	With no record (shadow rays), the group is only asked for any hit.
+	Return 1 if the group was hit closer than t_max, 0 otherwise
+*/
+int	hit_instance(t_instance *in, t_ray *ray, t_real t_max, t_hit_record *rec)
+{
+	t_ray			local;
+	t_hit_record	local_rec;
+
+	local.origin = vec3_div(to_group(in, vec3_sub(ray->origin, in->pos)),
+			in->scale);
+	local.direction = to_group(in, ray->direction);
+	local_rec.t = t_max / in->scale;
+	if (!rec)
+		return (accel_any_prims(in->group->accel, &local, local_rec.t));
+	if (!accel_hit_prims(in->group->accel, &local, &local_rec))
+		return (0);
+	*rec = local_rec;
+	rec->t = local_rec.t * in->scale;
+	rec->p = vec3_add(ray->origin, vec3_mul(ray->direction, rec->t));
+	rec->normal = to_scene(in, local_rec.normal);
+	return (1);
+}
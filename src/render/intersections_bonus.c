@@ -6,31 +6,12 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/03 18:40:52 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/14 15:56:26 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-// calculate color of the checker pattern
-// the floor() function replaced with `round()` because of "dust" artifacts
-static t_color	get_pattern_color(t_hit_record *rec, t_object *obj)
-{
-	double	scaled_x;
-	double	scaled_y;
-	double	scaled_z;
-	int		sum;
-
-	scaled_x = round(rec->p.x * obj->pattern_scale);
-	scaled_y = round(rec->p.y * obj->pattern_scale);
-	scaled_z = round(rec->p.z * obj->pattern_scale);
-	sum = (int)(scaled_x + scaled_y + scaled_z);
-	if (sum % 2 == 0)
-		return (obj->color);
-	else
-		return (obj->color2);
-}
-
 /* hit_sphere()
 	Tests for a ray-sphere intersection
 	Input:
@@ -51,7 +32,7 @@ static t_color	get_pattern_color(t_hit_record *rec, t_object *obj)
 		c = (O - C) * (O - C) - r^2
 	The discriminant of this equation (b^2 - 4*a*c)
 	determines if there are 0, 1, or 2 intersections. We find the smallest
-	positive root `t` that is within our accepted range [0.001, t_max].
+	positive root `t` that is within our accepted range [HIT_EPS, t_max].
 
 	- the normal of the sphere is pointing outwards from its center
 	- a ray hitting the sphere from outside will have an angle > 90 to the normal
@@ -61,25 +42,25 @@ static t_color	get_pattern_color(t_hit_record *rec, t_object *obj)
 		normal (flipping the point inwards). This guarantees the normal always
 		opposes the ray's direction, which is the standard rendering convention
 */
-int	hit_sphere(t_sphere *sp, t_ray *ray, double t_max, t_hit_record *rec)
+int	hit_sphere(t_sphere *sp, t_ray *ray, t_real t_max, t_hit_record *rec)
 {
 	t_vec3	oc;
-	double	a;
-	double	b;
-	double	c;
-	double	discriminant;
+	t_real	a;
+	t_real	b;
+	t_real	c;
+	t_real	discriminant;
 
 	oc = vec3_sub(ray->origin, sp->center);
 	a = vec3_length_squared(ray->direction);
 	b = 2 * vec3_dot(ray->direction, oc);
-	c = vec3_length_squared(oc) - sp->radius * sp->radius;
+	c = vec3_length_squared(oc) - sp->radius_sq;
 	discriminant = b * b - 4 * a * c;
 	if (discriminant < 0)
 		return (0);
 	rec->t = (-b - sqrt(discriminant)) / (2.0 * a);
-	if (rec->t <= 0.001 || rec->t >= t_max)
+	if (rec->t <= HIT_EPS || rec->t >= t_max)
 		rec->t = (-b + sqrt(discriminant)) / (2.0 * a);
-	if (rec->t <= 0.001 || rec->t >= t_max)
+	if (rec->t <= HIT_EPS || rec->t >= t_max)
 		return (0);
 	rec->p = vec3_add(ray->origin, vec3_mul(ray->direction, rec->t));
 	rec->normal = vec3_normalize(vec3_sub(rec->p, sp->center));
@@ -118,26 +99,26 @@ int	hit_sphere(t_sphere *sp, t_ray *ray, double t_max, t_hit_record *rec)
 		if denominator ~ 0 => no hit, return 0
 	2. Calculate the numerator = ((P₀ - O) · n)
 	3. Calculate t = numerator / denominator.
-	4. If t is outside the valid range [0.001, t_max], return 0
-		t > 0.001: The hit must be in front of the ray's origin. The small
+	4. If t is outside the valid range [HIT_EPS, t_max], return 0
+		t > HIT_EPS: The hit must be in front of the ray's origin. The small
 						epsilon prevents "shadow acne" or self-intersection
 		t < t_max: The hit must be closer than any other object already found
 	5. A valid intersection was found, we can populate the hit record
 	6. Ensure the normal points against the incident ray.
 		If the ray hits the "back" of the plane, flip the hit record normal
 */
-int	hit_plane(t_plane *pl, t_ray *ray, double t_max, t_hit_record *rec)
+int	hit_plane(t_plane *pl, t_ray *ray, t_real t_max, t_hit_record *rec)
 {
-	double	denominator;
-	double	numerator;
-	double	t;
+	t_real	denominator;
+	t_real	numerator;
+	t_real	t;
 
 	denominator = vec3_dot(ray->direction, pl->normal);
-	if (fabs(denominator) < 1e-6)
+	if (fabs(denominator) < PARALLEL_EPS)
 		return (0);
 	numerator = vec3_dot(vec3_sub(pl->point, ray->origin), pl->normal);
 	t = numerator / denominator;
-	if (t <= 0.001 || t >= t_max)
+	if (t <= HIT_EPS || t >= t_max)
 		return (0);
 	rec->t = t;
 	rec->p = vec3_add(ray->origin, vec3_mul(ray->direction, t));
@@ -164,7 +145,7 @@ int	hit_plane(t_plane *pl, t_ray *ray, double t_max, t_hit_record *rec)
 	It keeps track of the closest valid intersection found and, if any hit
 	occured, it populates the final hit_record with the t_hit_info values.
 */
-int	hit_cylinder(t_cylinder *cy, t_ray *ray, double t_max, t_hit_record *rec)
+int	hit_cylinder(t_cylinder *cy, t_ray *ray, t_real t_max, t_hit_record *rec)
 {
 	t_hit_info	info;
 
@@ -183,40 +164,3 @@ int	hit_cylinder(t_cylinder *cy, t_ray *ray, double t_max, t_hit_record *rec)
 	}
 	return (0);
 }
-
-/* hit_object()
-	A dispatcher function that calls the correct intersection routine
-	Input:
-		*obj:	a pointer to the generic object to test
-		*ray:	the ray to test against the object
-		t_max:	the maximum valid distance for an intersection
-		*rec:	the hit_record to populate on a successful hit
-	Return 1 if the object was hit, 0 otherwise
-
-	This function acts as a router.
-	Checks the `type` of the object and calls the appropriate `hit_...` function
-*/
-int	hit_object(t_object *obj, t_ray *ray, double t_max, t_hit_record *rec)
-{
-	int	hit;
-
-	hit = 0;
-	if (obj->type == SPHERE)
-		hit = hit_sphere(obj->shape_data, ray, t_max, rec);
-	else if (obj->type == PLANE)
-		hit = hit_plane(obj->shape_data, ray, t_max, rec);
-	else if (obj->type == CYLINDER)
-		hit = hit_cylinder(obj->shape_data, ray, t_max, rec);
-	else if (obj->type == CONE)
-		hit = hit_cone(obj->shape_data, ray, t_max, rec);
-	if (hit)
-	{
-		rec->color = obj->color;
-		rec->speci = obj->speci;
-		rec->shine = obj->shine;
-		rec->reflect = obj->reflect;
-		if (obj->checker == CHECKER)
-			rec->color = get_pattern_color(rec, obj);
-	}
-	return (hit);
-}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_avx_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:55:42 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifdef SIMD_KERNELS
+# include <immintrin.h>
+
+// reflect_sse() for the 4 lanes of the block
+__attribute__((target("avx")))
+static void	reflect_avx(t_shade *sh, __m256d d[3], __m256d dot)
+{
+	__m256d	r;
+	__m256d	spec;
+	int		a;
+
+	spec = _mm256_setzero_pd();
+	a = -1;
+	while (++a < 3)
+	{
+		r = _mm256_sub_pd(_mm256_sub_pd(_mm256_setzero_pd(), d[a]),
+				_mm256_mul_pd(_mm256_set1_pd(sh->n[a]), dot));
+		spec = _mm256_add_pd(spec, _mm256_mul_pd(_mm256_set1_pd(sh->v[a]),
+					r));
+	}
+	_mm256_storeu_pd(sh->spec, _mm256_max_pd(spec, _mm256_setzero_pd()));
+}
+
+/* light_dirs_avx()
+	light_dirs_sse() for the whole block of 4 lights at once, with AVX.
+	Only called if the CPU supports it (see light_simd_level()), the upper
+	halves of the registers are cleared before returning, as in
+	wbvh_test_avx().
+*/
+__attribute__((target("avx")))
+void	light_dirs_avx(t_light_soa *l, int first, t_shade *sh)
+{
+	__m256d	d[3];
+	__m256d	len;
+	__m256d	dot;
+	int		a;
+
+	a = -1;
+	while (++a < 3)
+		d[a] = _mm256_sub_pd(_mm256_loadu_pd(l->pos[a] + first),
+				_mm256_set1_pd(sh->p[a]));
+	len = _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(d[0],
+						d[0]), _mm256_mul_pd(d[1], d[1])),
+				_mm256_mul_pd(d[2], d[2])));
+	_mm256_storeu_pd(sh->dist, len);
+	dot = _mm256_setzero_pd();
+	a = -1;
+	while (++a < 3)
+	{
+		d[a] = _mm256_div_pd(d[a], len);
+		_mm256_storeu_pd(sh->dir[a], d[a]);
+		dot = _mm256_add_pd(dot, _mm256_mul_pd(_mm256_set1_pd(sh->n[a]),
+					d[a]));
+	}
+	_mm256_storeu_pd(sh->diffuse, _mm256_max_pd(dot, _mm256_setzero_pd()));
+	reflect_avx(sh, d, _mm256_mul_pd(dot, _mm256_set1_pd(-2.0)));
+	_mm256_zeroupper();
+}
+
+// light_mix() for the whole block, with AVX
+__attribute__((target("avx")))
+void	light_mix_avx(t_light_soa *l, int first, t_shade *sh)
+{
+	__m256d	c;
+	int		a;
+
+	a = -1;
+	while (++a < 3)
+	{
+		c = _mm256_loadu_pd(l->rgb[a] + first);
+		_mm256_storeu_pd(sh->rgb[a], _mm256_add_pd(_mm256_mul_pd(
+					_mm256_mul_pd(c, _mm256_set1_pd(sh->color[a])),
+					_mm256_loadu_pd(sh->diffuse)),
+				_mm256_mul_pd(c, _mm256_loadu_pd(sh->spec))));
+	}
+	_mm256_zeroupper();
+}
+#endif
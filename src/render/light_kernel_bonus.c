@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_kernel_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:54:54 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* light_dirs()
+	First half of the shading kernel, one lane at a time (the reference
+	for the SIMD versions, used where there is none): the unit direction
+	and the distance to each light, the diffuse term max(0, n . l) and the
+	specular angle max(0, v . r), r being -l reflected about the normal,
+	r = -l + 2 (n . l) n. The operations are done in the order of
+	vec3_normalize(), vec3_dot() and vec3_reflect().
+*/
+void	light_dirs(t_light_soa *l, int first, t_shade *sh)
+{
+	t_vec3	d;
+	t_real	len;
+	t_real	dot;
+	int		i;
+
+	i = -1;
+	while (++i < LIGHT_LANES)
+	{
+		d = (t_vec3){l->pos[0][first + i] - sh->p[0], l->pos[1][first + i]
+			- sh->p[1], l->pos[2][first + i] - sh->p[2]};
+		len = sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+		d = (t_vec3){d.x / len, d.y / len, d.z / len};
+		sh->dir[0][i] = d.x;
+		sh->dir[1][i] = d.y;
+		sh->dir[2][i] = d.z;
+		sh->dist[i] = len;
+		dot = sh->n[0] * d.x + sh->n[1] * d.y + sh->n[2] * d.z;
+		sh->diffuse[i] = fmax(0.0, dot);
+		dot *= -2.0;
+		sh->spec[i] = fmax(0.0, sh->v[0] * (-d.x - sh->n[0] * dot)
+				+ sh->v[1] * (-d.y - sh->n[1] * dot)
+				+ sh->v[2] * (-d.z - sh->n[2] * dot));
+	}
+}
+
+/* light_mix()
+	Second half of the kernel: the color each light adds, its color (times
+	its ratio) filtered by the surface color and scaled by the diffuse
+	term, plus its color scaled by the specular term
+*/
+void	light_mix(t_light_soa *l, int first, t_shade *sh)
+{
+	t_real	c;
+	int		a;
+	int		i;
+
+	a = -1;
+	while (++a < 3)
+	{
+		i = -1;
+		while (++i < LIGHT_LANES)
+		{
+			c = l->rgb[a][first + i];
+			sh->rgb[a][i] = c * sh->color[a] * sh->diffuse[i]
+				+ c * sh->spec[i];
+		}
+	}
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_nosimd_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:55:42 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifndef SIMD_KERNELS
+
+// other CPUs and the float build (see SIMD_KERNELS): no SIMD kernel,
+// light_block() shades one light at a time
+void	light_dirs_sse(t_light_soa *l, int first, t_shade *sh, int k)
+{
+	(void)l;
+	(void)first;
+	(void)sh;
+	(void)k;
+}
+
+void	light_mix_sse(t_light_soa *l, int first, t_shade *sh, int k)
+{
+	(void)l;
+	(void)first;
+	(void)sh;
+	(void)k;
+}
+
+void	light_dirs_avx(t_light_soa *l, int first, t_shade *sh)
+{
+	(void)l;
+	(void)first;
+	(void)sh;
+}
+
+void	light_mix_avx(t_light_soa *l, int first, t_shade *sh)
+{
+	(void)l;
+	(void)first;
+	(void)sh;
+}
+
+t_simd_level	light_simd_level(void)
+{
+	return (SIMD_NONE);
+}
+#endif
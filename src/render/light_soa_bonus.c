@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_soa_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:54:47 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// points the arrays into the block and copies the lights of the list
+static void	fill(t_light_soa *l, t_light *light, int padded)
+{
+	t_color	rgb;
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		l->pos[i] = l->block + i * padded;
+		l->rgb[i] = l->block + (3 + i) * padded;
+	}
+	i = 0;
+	while (light)
+	{
+		rgb = vec3_mul(light->color, light->ratio);
+		l->pos[0][i] = light->position.x;
+		l->pos[1][i] = light->position.y;
+		l->pos[2][i] = light->position.z;
+		l->rgb[0][i] = rgb.x;
+		l->rgb[1][i] = rgb.y;
+		l->rgb[2][i++] = rgb.z;
+		light = light->next;
+	}
+}
+
+/* light_compile()
+	Copies the lights of the scene's list into flat arrays, once it is
+	loaded: positions and colors x, y and z apart, each color multiplied
+	by the ratio of its light. The padding up to a multiple of LIGHT_LANES
+	is zeroed: black lights, their lanes are computed and then ignored
+	(see calculate_lighting()). Picks the shading kernel for this CPU.
+	Return 1 on success, 0 on allocation failure
+*/
+int	light_compile(t_scene *scene)
+{
+	t_light_soa	*l;
+	t_light		*light;
+	int			padded;
+
+	l = &scene->light_soa;
+	l->count = 0;
+	light = scene->lights;
+	while (light && ++l->count)
+		light = light->next;
+	padded = (l->count + LIGHT_LANES - 1) / LIGHT_LANES * LIGHT_LANES;
+	l->block = ft_calloc(6 * padded + 1, sizeof(t_real));
+	if (!l->block)
+		return (0);
+	fill(l, scene->lights, padded);
+	l->simd = light_simd_level();
+	return (1);
+}
+
+void	light_soa_free(t_light_soa *l)
+{
+	free(l->block);
+	l->block = NULL;
+	l->count = 0;
+}
+
+// the shine power of the specular angles of the n first lanes (at most
+// LIGHT_LANES), pow() has no SIMD version. No specular: no power at all.
+static void	spec_powers(t_shade *sh, int n)
+{
+	int	i;
+
+	i = -1;
+	while (++i < LIGHT_LANES && i < n)
+	{
+		if (sh->speci == 0.0)
+			sh->spec[i] = 0.0;
+		else
+			sh->spec[i] = pow(sh->spec[i], sh->shine) * sh->speci;
+	}
+}
+
+/* light_block()
+	Shades the point of *sh with the LIGHT_LANES lights from `first` on:
+	their directions and distances, the diffuse and specular terms, then
+	the color each one adds, with the kernel of the CPU (AVX: 4 lights at
+	a time, SSE2: 2). Shadows are not known yet, see calculate_lighting().
+*/
+void	light_block(t_light_soa *l, int first, t_shade *sh)
+{
+	if (l->simd == SIMD_AVX)
+		light_dirs_avx(l, first, sh);
+	else if (l->simd == SIMD_SSE)
+	{
+		light_dirs_sse(l, first, sh, 0);
+		light_dirs_sse(l, first, sh, 2);
+	}
+	else
+		light_dirs(l, first, sh);
+	spec_powers(sh, l->count - first);
+	if (l->simd == SIMD_AVX)
+		light_mix_avx(l, first, sh);
+	else if (l->simd == SIMD_SSE)
+	{
+		light_mix_sse(l, first, sh, 0);
+		light_mix_sse(l, first, sh, 2);
+	}
+	else
+		light_mix(l, first, sh);
+}
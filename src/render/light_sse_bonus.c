@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_sse_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:55:42 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#ifdef SIMD_KERNELS
+# include <immintrin.h>
+
+// the specular angles max(0, v . r) of lanes k, k + 1, r = -d - n * dot
+// being the unit directions d reflected about the normal, dot = -2 n . d
+static void	reflect_sse(t_shade *sh, int k, __m128d d[3], __m128d dot)
+{
+	__m128d	r;
+	__m128d	spec;
+	int		a;
+
+	spec = _mm_setzero_pd();
+	a = -1;
+	while (++a < 3)
+	{
+		r = _mm_sub_pd(_mm_sub_pd(_mm_setzero_pd(), d[a]),
+				_mm_mul_pd(_mm_set1_pd(sh->n[a]), dot));
+		spec = _mm_add_pd(spec, _mm_mul_pd(_mm_set1_pd(sh->v[a]), r));
+	}
+	_mm_storeu_pd(sh->spec + k, _mm_max_pd(spec, _mm_setzero_pd()));
+}
+
+/* light_dirs_sse()
+	light_dirs() for the 2 lights k, k + 1 of the block, with SSE2 (part
+	of x86-64): the same operations in the same order, lane by lane
+*/
+void	light_dirs_sse(t_light_soa *l, int first, t_shade *sh, int k)
+{
+	__m128d	d[3];
+	__m128d	len;
+	__m128d	dot;
+	int		a;
+
+	a = -1;
+	while (++a < 3)
+		d[a] = _mm_sub_pd(_mm_loadu_pd(l->pos[a] + first + k),
+				_mm_set1_pd(sh->p[a]));
+	len = _mm_sqrt_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(d[0], d[0]),
+					_mm_mul_pd(d[1], d[1])), _mm_mul_pd(d[2], d[2])));
+	_mm_storeu_pd(sh->dist + k, len);
+	dot = _mm_setzero_pd();
+	a = -1;
+	while (++a < 3)
+	{
+		d[a] = _mm_div_pd(d[a], len);
+		_mm_storeu_pd(sh->dir[a] + k, d[a]);
+		dot = _mm_add_pd(dot, _mm_mul_pd(_mm_set1_pd(sh->n[a]), d[a]));
+	}
+	_mm_storeu_pd(sh->diffuse + k, _mm_max_pd(dot, _mm_setzero_pd()));
+	reflect_sse(sh, k, d, _mm_mul_pd(dot, _mm_set1_pd(-2.0)));
+}
+
+// light_mix() for the 2 lights k, k + 1 of the block, with SSE2
+void	light_mix_sse(t_light_soa *l, int first, t_shade *sh, int k)
+{
+	__m128d	c;
+	int		a;
+
+	a = -1;
+	while (++a < 3)
+	{
+		c = _mm_loadu_pd(l->rgb[a] + first + k);
+		_mm_storeu_pd(sh->rgb[a] + k, _mm_add_pd(_mm_mul_pd(_mm_mul_pd(c,
+							_mm_set1_pd(sh->color[a])),
+						_mm_loadu_pd(sh->diffuse + k)),
+				_mm_mul_pd(c, _mm_loadu_pd(sh->spec + k))));
+	}
+}
+
+/* light_simd_level()
+	SSE2 is part of x86-64, AVX is checked at run time (CPUID)
+*/
+t_simd_level	light_simd_level(void)
+{
+	if (__builtin_cpu_supports("avx"))
+		return (SIMD_AVX);
+	return (SIMD_SSE);
+}
+#endif
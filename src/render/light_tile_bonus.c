@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   light_tile_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:29:41 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:35:17 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the shadow ray from the point of camera ray i toward light j of the block,
+// as calculate_lighting() casts it (see shadow_blocks()), added to the
+// packet; none if the light adds nothing there (see add_visible())
+static void	shadow_ray(t_tile_shade *ts, int i, int j)
+{
+	t_shade	*sh;
+	t_ray	*ray;
+
+	sh = &ts->sh[i];
+	if (!(sh->dist[j] > 0.0) || (sh->rgb[0][j] == 0.0
+			&& sh->rgb[1][j] == 0.0 && sh->rgb[2][j] == 0.0))
+		return ;
+	ray = &ts->shadow.ray[ts->shadow.n];
+	ray->direction = (t_vec3){sh->dir[0][j], sh->dir[1][j], sh->dir[2][j]};
+	ray->origin = vec3_add((t_point3){sh->p[0], sh->p[1], sh->p[2]},
+			vec3_mul(ray->direction, HIT_EPS));
+	ts->shadow.rec[ts->shadow.n].t = sh->dist[j];
+	ts->from[ts->shadow.n++] = i;
+}
+
+// light j of the block, for the points of the camera rays of mask lit: their
+// shadow rays are traced as one packet, and the light is added to the
+// colors of the points it reaches
+static void	cast_light(t_scene *scene, t_tile_shade *ts, unsigned long lit,
+		int j)
+{
+	t_shade	*sh;
+	int		k;
+
+	ts->shadow.n = 0;
+	while (lit)
+	{
+		shadow_ray(ts, __builtin_ctzl(lit), j);
+		lit &= lit - 1;
+	}
+	if (ts->shadow.n == 0)
+		return ;
+	packet_any_hit(scene->accel, &ts->shadow);
+	k = -1;
+	while (++k < ts->shadow.n)
+	{
+		if (ts->shadow.hit >> k & 1)
+			continue ;
+		sh = &ts->sh[ts->from[k]];
+		ts->color[ts->from[k]].x += sh->rgb[0][j];
+		ts->color[ts->from[k]].y += sh->rgb[1][j];
+		ts->color[ts->from[k]].z += sh->rgb[2][j];
+	}
+}
+
+// the ambient color of the points of the camera rays of the packet that hit
+// something, and their shading set up (see calculate_lighting())
+static void	tile_init(t_scene *scene, t_packet *pk, t_tile_shade *ts)
+{
+	unsigned long	lit;
+	int				i;
+
+	lit = pk->hit;
+	while (lit)
+	{
+		i = __builtin_ctzl(lit);
+		lit &= lit - 1;
+		ts->color[i] = vec3_color_mul(vec3_mul(scene->ambient_light,
+					scene->ambient_ratio), pk->rec[i].color);
+		shade_init(&ts->sh[i], &pk->rec[i], scene);
+	}
+}
+
+// the lights of the block from first shaded at the points of the camera
+// rays of mask lit (see light_block())
+static void	shade_block(t_scene *scene, t_tile_shade *ts, unsigned long lit,
+		int first)
+{
+	while (lit)
+	{
+		light_block(&scene->light_soa, first, &ts->sh[__builtin_ctzl(lit)]);
+		lit &= lit - 1;
+	}
+}
+
+/* light_tile()
+	calculate_lighting() for all the camera rays of the packet that hit
+	something, in ts->color: the lights are shaded at each point block
+	after block as for a point alone, but the shadow rays toward each light
+	leave the points of the tile together, as a packet (see
+	packet_any_hit()). Neighbouring points see a light along close
+	directions, and their rays mostly cross the same nodes of the tree.
+	The lights are added to each color in the same order as for a point
+	alone, the colors are the same.
+*/
+void	light_tile(t_scene *scene, t_packet *pk, t_tile_shade *ts)
+{
+	unsigned long	lit;
+	int				first;
+	int				i;
+
+	tile_init(scene, pk, ts);
+	first = 0;
+	while (first < scene->light_soa.count)
+	{
+		shade_block(scene, ts, pk->hit, first);
+		i = -1;
+		while (++i < LIGHT_LANES && first + i < scene->light_soa.count)
+			cast_light(scene, ts, pk->hit, i);
+		first += LIGHT_LANES;
+	}
+	lit = pk->hit;
+	while (lit)
+	{
+		i = __builtin_ctzl(lit);
+		lit &= lit - 1;
+		ts->color[i] = clamp_color(ts->color[i]);
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/04 07:13:43 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/08 16:26:40 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,21 +23,21 @@
 	It works by creating a new "shadow ray" that originates from the hit point
 	and travels towards the light. We then check if this ray intersects with
 	any other object in the scene before it reaches the light.
-	A small epsilon (0.001) is added to the ray's origin to prevent the ray
+	A small epsilon (HIT_EPS) is added to the ray's origin to prevent the ray
 	from intersecting with the object it originated from ("shadow acne").
 */
 int	is_in_shadow(t_point3 hit_point, t_light *light, t_scene *scene)
 {
 	t_ray			shadow_ray;
 	t_hit_record	rec;
-	double			light_dist;
+	t_real			light_dist;
 	t_object		*obj;
 
 	shadow_ray.direction = vec3_sub(light->position, hit_point);
 	light_dist = vec3_length(shadow_ray.direction);
 	shadow_ray.direction = vec3_normalize(shadow_ray.direction);
 	shadow_ray.origin = vec3_add(hit_point, vec3_mul(shadow_ray.direction,
-				0.001));
+				HIT_EPS));
 	obj = scene->objects;
 	while (obj)
 	{
@@ -99,7 +99,7 @@ t_color	calculate_lighting(t_hit_record *rec, t_scene *scene)
 {
 	t_color	final_color;
 	t_vec3	light_dir;
-	double	diffuse_intensity;
+	t_real	diffuse_intensity;
 	t_light	*light;
 
 	final_color = vec3_mul(scene->ambient_light, scene->ambient_ratio);
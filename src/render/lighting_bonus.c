@@ -6,13 +6,14 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/04 07:13:43 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/09 16:56:49 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:35:17 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-static t_color	clamp_color(t_color color)
+// each channel of the color, at most 1
+t_color	clamp_color(t_color color)
 {
 	color.x = fmin(1.0, color.x);
 	color.y = fmin(1.0, color.y);
@@ -20,56 +21,72 @@ static t_color	clamp_color(t_color color)
 	return (color);
 }
 
-static t_color	add_spec_contrib(t_hit_record *rec, t_light *light,
-	t_scene *scene, t_color final_color)
+// the point to shade, its surface and the direction to the camera, seen
+// by every light: computed once for all of them
+void	shade_init(t_shade *sh, t_hit_record *rec, t_scene *scene)
 {
-	t_spec_contrib	sc;
-
-	sc.light_dir = vec3_normalize(vec3_sub(light->position, rec->p));
-	sc.view_dir = vec3_normalize(vec3_sub(scene->camera.origin, rec->p));
-	sc.reflect_dir = vec3_reflect(vec3_mul(sc.light_dir, -1), rec->normal);
-	sc.spec_angle = fmax(0.0, vec3_dot(sc.view_dir, sc.reflect_dir));
-	sc.spec_intensity = pow(sc.spec_angle, rec->shine);
-	sc.spec_contrib = vec3_mul(light->color, sc.spec_intensity * rec->speci);
-	sc.spec_contrib = vec3_mul(sc.spec_contrib, light->ratio);
-	final_color = vec3_add(final_color, sc.spec_contrib);
-	return (final_color);
+	t_vec3	v;
+
+	v = vec3_normalize(vec3_sub(scene->camera.origin, rec->p));
+	sh->p[0] = rec->p.x;
+	sh->p[1] = rec->p.y;
+	sh->p[2] = rec->p.z;
+	sh->n[0] = rec->normal.x;
+	sh->n[1] = rec->normal.y;
+	sh->n[2] = rec->normal.z;
+	sh->v[0] = v.x;
+	sh->v[1] = v.y;
+	sh->v[2] = v.z;
+	sh->color[0] = rec->color.x;
+	sh->color[1] = rec->color.y;
+	sh->color[2] = rec->color.z;
+	sh->speci = rec->speci;
+	sh->shine = rec->shine;
 }
 
-/* is_in_shadow()
-	Checks if a given point is in shadow from a specific light source
-	Input:
-		hit_point:	the point on the surface we are shading
-		*light:		the light source to check against
-		*scene:		the scene containing all objects
-	Return: 1 if the point is in shadow, 0 otherwise
-
-	It works by creating a new "shadow ray" that originates from the hit point
-	and travels towards the light. We then check if this ray intersects with
-	any other object in the scene before it reaches the light.
-	A small epsilon (0.001) is added to the ray's origin to prevent the ray
-	from intersecting with the object it originated from ("shadow acne").
+/* shadow_blocks()
+	Casts the shadow ray toward light i of the block, along the direction
+	and up to the distance the kernel found. The origin is moved by a small
+	epsilon (HIT_EPS) toward the light, so that the ray does not hit the
+	object it starts from ("shadow acne").
+	Return 1 if the light is hidden by an object, 0 otherwise
+*/
+static int	shadow_blocks(t_shade *sh, int i, t_scene *scene)
+{
+	t_ray	shadow_ray;
+
+	shadow_ray.direction = (t_vec3){sh->dir[0][i], sh->dir[1][i],
+		sh->dir[2][i]};
+	shadow_ray.origin = vec3_add((t_point3){sh->p[0], sh->p[1], sh->p[2]},
+			vec3_mul(shadow_ray.direction, HIT_EPS));
+	return (accel_any_hit(scene->accel, &shadow_ray, sh->dist[i]));
+}
+
+/* add_visible()
+	Adds the colors of the lights of the block that reach the point. A
+	light adding nothing (behind the surface, no highlight) casts no shadow
+	ray: its shadow would not change the color. Neither does a padding lane
+	(past l->count) nor a light right on the point.
+	Return: the color with the lights added
 */
-int	is_in_shadow(t_point3 hit_point, t_light *light, t_scene *scene)
+static t_color	add_visible(t_scene *scene, t_shade *sh, int first,
+		t_color color)
 {
-	t_ray			shadow_ray;
-	t_hit_record	rec;
-	double			light_dist;
-	t_object		*obj;
-
-	shadow_ray.direction = vec3_sub(light->position, hit_point);
-	light_dist = vec3_length(shadow_ray.direction);
-	shadow_ray.direction = vec3_normalize(shadow_ray.direction);
-	shadow_ray.origin = vec3_add(hit_point, vec3_mul(shadow_ray.direction,
-				0.001));
-	obj = scene->objects;
-	while (obj)
+	int	i;
+
+	i = -1;
+	while (++i < LIGHT_LANES && first + i < scene->light_soa.count)
 	{
-		if (hit_object(obj, &shadow_ray, light_dist, &rec))
-			return (1);
-		obj = obj->next;
+		if (!(sh->dist[i] > 0.0) || (sh->rgb[0][i] == 0.0
+				&& sh->rgb[1][i] == 0.0 && sh->rgb[2][i] == 0.0))
+			continue ;
+		if (shadow_blocks(sh, i, scene))
+			continue ;
+		color.x += sh->rgb[0][i];
+		color.y += sh->rgb[1][i];
+		color.z += sh->rgb[2][i];
 	}
-	return (0);
+	return (color);
 }
 
 /* calculate_lighting()
@@ -79,12 +96,13 @@ int	is_in_shadow(t_point3 hit_point, t_light *light, t_scene *scene)
 		*scene	the scene, containing lights and ambient light information
 	Return: the final computed t_color for the point
 
-	The function implements the Phong lighting model (mandatory part).
-	It starts with the base ambient light. Then for each light in the scene it
-	checks if the point is in shadow. If not, it calculates the diffuse
+	The function implements the Phong lighting model.
+	It starts with the base ambient light. Then the lights of the scene are
+	shaded LIGHT_LANES at a time with SIMD (see light_block()): the diffuse
 	contribution based on the angle between the surface normal and the light
-	direction (Lambert's cosine law) and adds it to the final color.
-	Finally clamp colors to [0,1] range
+	direction (Lambert's cosine law) and the specular one. Each light that
+	adds anything is then checked for shadow, and added to the final color
+	if it reaches the point. Finally clamp colors to [0,1] range
 
 	Phong model:
 	1.) Ambient Lighting: This represents indirect,
@@ -122,27 +140,18 @@ int	is_in_shadow(t_point3 hit_point, t_light *light, t_scene *scene)
 t_color	calculate_lighting(t_hit_record *rec, t_scene *scene)
 {
 	t_color	final_color;
-	t_vec3	light_dir;
-	double	diffuse_intensity;
-	t_color	diffuse_color;
-	t_light	*light;
+	t_shade	sh;
+	int		first;
 
 	final_color = vec3_mul(scene->ambient_light, scene->ambient_ratio);
 	final_color = vec3_color_mul(final_color, rec->color);
-	light = scene->lights;
-	while (light)
+	shade_init(&sh, rec, scene);
+	first = 0;
+	while (first < scene->light_soa.count)
 	{
-		if (!is_in_shadow(rec->p, light, scene))
-		{
-			light_dir = vec3_normalize(vec3_sub(light->position, rec->p));
-			diffuse_intensity = fmax(0.0, vec3_dot(rec->normal, light_dir));
-			diffuse_color = vec3_color_mul(light->color, rec->color);
-			diffuse_color = vec3_mul(diffuse_color,
-					diffuse_intensity * light->ratio);
-			final_color = vec3_add(final_color, diffuse_color);
-			final_color = add_spec_contrib(rec, light, scene, final_color);
-		}
-		light = light->next;
+		light_block(&scene->light_soa, first, &sh);
+		final_color = add_visible(scene, &sh, first, final_color);
+		first += LIGHT_LANES;
 	}
 	final_color = clamp_color(final_color);
 	return (final_color);
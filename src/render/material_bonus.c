@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   material_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:36:44 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// calculate color of the checker pattern
+// the floor() function replaced with `round()` because of "dust" artifacts
+static t_color	pattern_color(t_material *m, t_hit_record *rec)
+{
+	t_real	scaled_x;
+	t_real	scaled_y;
+	t_real	scaled_z;
+	int		sum;
+
+	scaled_x = round(rec->p.x * m->pattern_scale);
+	scaled_y = round(rec->p.y * m->pattern_scale);
+	scaled_z = round(rec->p.z * m->pattern_scale);
+	sum = (int)(scaled_x + scaled_y + scaled_z);
+	if (sum % 2 == 0)
+		return (m->color);
+	else
+		return (m->color2);
+}
+
+// copies the shading data of an object into its compiled material
+void	material_pack(t_material *m, t_object *obj)
+{
+	m->color = obj->color;
+	m->color2 = obj->color2;
+	m->pattern_scale = obj->pattern_scale;
+	m->speci = obj->speci;
+	m->shine = obj->shine;
+	m->reflect = obj->reflect;
+	m->checker = obj->checker;
+}
+
+/* material_apply()
+	Fills the shading part of a hit record with the material of the
+	primitive hit: its color, or the checker pattern's at the hit point
+*/
+void	material_apply(t_material *m, t_hit_record *rec)
+{
+	rec->color = m->color;
+	rec->speci = m->speci;
+	rec->shine = m->shine;
+	rec->reflect = m->reflect;
+	if (m->checker == CHECKER)
+		rec->color = pattern_color(m, rec);
+}
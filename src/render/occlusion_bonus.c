@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   occlusion_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:00:27 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* occlude_sphere()
+	Occlusion test of a sphere (shadow rays): is it hit in [HIT_EPS, t_max]?
+	The same quadratic as hit_sphere(), but the first root in range is
+	enough: no hit point, no normal, no material.
+	Return 1 if the sphere is hit closer than t_max, 0 otherwise
+*/
+int	occlude_sphere(t_sphere *sp, t_ray *ray, t_real t_max)
+{
+	t_vec3	oc;
+	t_real	a;
+	t_real	b;
+	t_real	discriminant;
+	t_real	t;
+
+	oc = vec3_sub(ray->origin, sp->center);
+	a = vec3_length_squared(ray->direction);
+	b = 2 * vec3_dot(ray->direction, oc);
+	discriminant = b * b - 4 * a * (vec3_length_squared(oc) - sp->radius_sq);
+	if (discriminant < 0)
+		return (0);
+	t = (-b - sqrt(discriminant)) / (2.0 * a);
+	if (t > HIT_EPS && t < t_max)
+		return (1);
+	t = (-b + sqrt(discriminant)) / (2.0 * a);
+	return (t > HIT_EPS && t < t_max);
+}
+
+// occlusion test of a plane: the distance of hit_plane(), nothing else
+int	occlude_plane(t_plane *pl, t_ray *ray, t_real t_max)
+{
+	t_real	denominator;
+	t_real	t;
+
+	denominator = vec3_dot(ray->direction, pl->normal);
+	if (fabs(denominator) < PARALLEL_EPS)
+		return (0);
+	t = vec3_dot(vec3_sub(pl->point, ray->origin), pl->normal) / denominator;
+	return (t > HIT_EPS && t < t_max);
+}
+
+/* occlude_disc()
+	Occlusion test of a cap disc of a cylinder or a cone: the plane of the
+	disc is hit in range, at a point no farther than r (r_sq = r²) from
+	its center. Computed like hit_plane() and check_single_cap().
+	Return 1 if the disc is hit closer than t_max, 0 otherwise
+*/
+int	occlude_disc(t_plane *disc, t_real r_sq, t_ray *ray, t_real t_max)
+{
+	t_real	denominator;
+	t_real	t;
+	t_vec3	p;
+
+	denominator = vec3_dot(ray->direction, disc->normal);
+	if (fabs(denominator) < PARALLEL_EPS)
+		return (0);
+	t = vec3_dot(vec3_sub(disc->point, ray->origin), disc->normal)
+		/ denominator;
+	if (t <= HIT_EPS || t >= t_max)
+		return (0);
+	p = vec3_add(ray->origin, vec3_mul(ray->direction, t));
+	return (vec3_length_squared(vec3_sub(p, disc->point)) <= r_sq);
+}
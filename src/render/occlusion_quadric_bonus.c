@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   occlusion_quadric_bonus.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:00:27 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// a root t of the cylinder wall in range and between the two caps
+static int	wall_root(t_cylinder *cy, t_ray *r, t_real t, t_real t_max)
+{
+	t_point3	p;
+	t_real		m;
+
+	if (t <= HIT_EPS || t >= t_max)
+		return (0);
+	p = vec3_add(r->origin, vec3_mul(r->direction, t));
+	m = vec3_dot(vec3_sub(p, cy->center), cy->axis);
+	return (m >= 0 && m <= cy->height);
+}
+
+// the wall quadratic of intersect_cylinder_wall(), either root will do
+static int	cylinder_wall(t_cylinder *cy, t_ray *r, t_real t_max)
+{
+	t_quadratic	q;
+	t_vec3		oc;
+	t_real		d_dot_a;
+	t_real		oc_dot_a;
+
+	oc = vec3_sub(r->origin, cy->center);
+	d_dot_a = vec3_dot(r->direction, cy->axis);
+	oc_dot_a = vec3_dot(oc, cy->axis);
+	q.a = vec3_dot(r->direction, r->direction) - d_dot_a * d_dot_a;
+	q.b = 2 * (vec3_dot(r->direction, oc) - d_dot_a * oc_dot_a);
+	q.c = vec3_dot(oc, oc) - oc_dot_a * oc_dot_a - cy->radius_sq;
+	q.discriminant = q.b * q.b - 4 * q.a * q.c;
+	if (q.discriminant < 0)
+		return (0);
+	q.t1 = (-q.b - sqrt(q.discriminant)) / (2 * q.a);
+	if (wall_root(cy, r, q.t1, t_max))
+		return (1);
+	q.t2 = (-q.b + sqrt(q.discriminant)) / (2 * q.a);
+	return (wall_root(cy, r, q.t2, t_max));
+}
+
+/* occlude_cylinder()
+	Occlusion test of a cylinder (shadow rays): the wall, then the two
+	caps, stopping at the first part hit in [HIT_EPS, t_max]. Whichever part
+	is hit first along the ray does not matter here, so no part narrows the
+	range of the next one, and no normal is computed.
+	Return 1 if the cylinder is hit closer than t_max, 0 otherwise
+*/
+int	occlude_cylinder(t_cylinder *cy, t_ray *ray, t_real t_max)
+{
+	if (cylinder_wall(cy, ray, t_max))
+		return (1);
+	if (occlude_disc(&(t_plane){cy->center, vec3_mul(cy->axis, -1)},
+		cy->radius_sq, ray, t_max))
+		return (1);
+	return (occlude_disc(&(t_plane){cy->top, cy->axis}, cy->radius_sq, ray,
+		t_max));
+}
+
+// the wall quadratic of the cone (see cone_intersect.c), either root
+static int	cone_wall(t_cone *co, t_ray *r, t_real t_max)
+{
+	t_quadratic	q;
+	t_vec3		oc;
+	t_real		d_dot_a;
+	t_real		oc_dot_a;
+
+	oc = vec3_sub(r->origin, co->tip);
+	d_dot_a = vec3_dot(r->direction, co->axis);
+	oc_dot_a = vec3_dot(oc, co->axis);
+	q.a = d_dot_a * d_dot_a - co->cos_angle_sq;
+	q.b = 2 * (d_dot_a * oc_dot_a - vec3_dot(r->direction, oc)
+			* co->cos_angle_sq);
+	q.c = oc_dot_a * oc_dot_a - vec3_dot(oc, oc) * co->cos_angle_sq;
+	q.discriminant = q.b * q.b - 4 * q.a * q.c;
+	if (q.discriminant < 0)
+		return (0);
+	q.t1 = (-q.b - sqrt(q.discriminant)) / (2 * q.a);
+	q.t2 = (-q.b + sqrt(q.discriminant)) / (2 * q.a);
+	return ((q.t1 > HIT_EPS && q.t1 < t_max && oc_dot_a + q.t1 * d_dot_a >= 0
+			&& oc_dot_a + q.t1 * d_dot_a <= co->height)
+		|| (q.t2 > HIT_EPS && q.t2 < t_max && oc_dot_a + q.t2 * d_dot_a >= 0
+			&& oc_dot_a + q.t2 * d_dot_a <= co->height));
+}
+
+// occlusion test of a cone: its base cap, then its wall, as hit_cone()
+int	occlude_cone(t_cone *co, t_ray *ray, t_real t_max)
+{
+	if (occlude_disc(&(t_plane){co->base, co->axis}, co->cap_r_sq, ray,
+		t_max))
+		return (1);
+	return (cone_wall(co, ray, t_max));
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_render_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:11:30 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:45:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the camera rays of the tile of tile[2] x tile[2] pixels whose top left
+// corner is (tile[0], tile[1]), clipped to the image, row after row, and
+// their frustum
+static void	tile_rays(t_scene *scene, t_packet *pk, int tile[3])
+{
+	int	w;
+	int	h;
+	int	i;
+
+	w = min(tile[2], scene->width - tile[0]);
+	h = min(tile[2], scene->height - tile[1]);
+	pk->n = w * h;
+	i = -1;
+	while (++i < pk->n)
+		pk->ray[i] = get_ray(&scene->camera, tile[0] + i % w,
+				tile[1] + i / w);
+	frustum_init(&pk->fr, &scene->camera,
+		(int [4]){tile[0], tile[1], tile[0] + w, tile[1] + h});
+}
+
+/* coherent()
+	Whether the rays of the packet go the same way: the same sign on each
+	axis of their directions. The rays of a packet then enter the boxes
+	through the same faces and mostly visit the children of a node in the
+	same order, which the first ray decides for all (see packet_walk()).
+	Return 1 if they do, 0 if the packet is to be split
+*/
+static int	coherent(t_packet *pk)
+{
+	t_vec3	d;
+	int		i;
+
+	d = pk->ray[0].direction;
+	i = 0;
+	while (++i < pk->n)
+		if ((pk->ray[i].direction.x < 0) != (d.x < 0)
+			|| (pk->ray[i].direction.y < 0) != (d.y < 0)
+			|| (pk->ray[i].direction.z < 0) != (d.z < 0))
+			return (0);
+	return (1);
+}
+
+// shades each ray of the packet traced for the tile: the lighting of the
+// tile with its shadow rays in packets, then the reflections one by one
+static void	shade_tile(t_scene *scene, t_mlx_data *mlx, t_packet *pk,
+		int tile[3])
+{
+	t_tile_shade	ts;
+	t_color			color;
+	int				w;
+	int				i;
+
+	light_tile(scene, pk, &ts);
+	w = min(tile[2], scene->width - tile[0]);
+	i = -1;
+	while (++i < pk->n)
+	{
+		color = (t_color){0, 0, 0};
+		if (pk->hit >> i & 1)
+			color = vec3_add(vec3_mul(ts.color[i], 1.0 - pk->rec[i].reflect),
+					vec3_mul(ray_reflect(&pk->ray[i], &pk->rec[i], scene,
+							MAX_DEPTH), pk->rec[i].reflect));
+		my_put_pixel_to_img(mlx, tile[0] + i % w, tile[1] + i / w,
+			color_to_int(color));
+	}
+}
+
+/* trace_tile()
+	Traces the camera rays of a tile as one packet, then shades them.
+	A tile whose rays straddle an axis (the view direction crossing it) is
+	split in 4 packets of half the size, down to single rays.
+*/
+static void	trace_tile(t_scene *scene, t_mlx_data *mlx, int tile[3])
+{
+	t_packet	pk;
+	int			i;
+
+	tile_rays(scene, &pk, tile);
+	if (tile[2] > 1 && !coherent(&pk))
+	{
+		i = -1;
+		while (++i < 4)
+			if (tile[0] + i % 2 * tile[2] / 2 < scene->width
+				&& tile[1] + i / 2 * tile[2] / 2 < scene->height)
+				trace_tile(scene, mlx, (int [3]){tile[0] + i % 2 * tile[2]
+					/ 2, tile[1] + i / 2 * tile[2] / 2, tile[2] / 2});
+		return ;
+	}
+	packet_closest_hit(scene->accel, &pk);
+	shade_tile(scene, mlx, &pk, tile);
+}
+
+/* render_packets()
+	render() with --packet N (2, 4 or 8): the pixels of rect (x0, y0, x1,
+	y1 excluded, one tile of render_tiles()) are cut in tiles of N x N
+	pixels, whose camera rays are traced together (see trace_tile()).
+	The images are those of the rays traced one by one.
+*/
+void	render_packets(t_scene *scene, t_mlx_data *mlx, int rect[4])
+{
+	int	x;
+	int	y;
+
+	y = rect[1];
+	while (y < rect[3])
+	{
+		x = rect[0];
+		while (x < rect[2])
+		{
+			trace_tile(scene, mlx, (int [3]){x, y, scene->packet});
+			x += scene->packet;
+		}
+		y += scene->packet;
+	}
+}
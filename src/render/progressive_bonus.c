@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   progressive_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:54:46 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:01:10 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* render()
+	Input:
+		*scene:		the fully parsed scene to be rendered
+		*mlx		the minilibX data structure containing the image buffer
+	Return: void, fill the buffer in place
+
+	Sets up the camera with setup_camera(), then renders the image with
+	render_tiles(): the image is cut in tiles, rendered by render_rect() on
+	scene->threads threads (--threads N). Returns once the frame is done.
+*/
+void	render(t_scene *scene, t_mlx_data *mlx)
+{
+	setup_camera(&scene->camera, scene->width, scene->height);
+	render_tiles(scene, mlx);
+}
+
+/* display_hook()
+	Loop hook of the window while the frame renders in the background:
+	puts the image in the window when tiles were rendered since the last
+	time, DISPLAY_HZ times per second at most, so that they show as they
+	are done. Otherwise it sleeps for a millisecond: the loop would spin on
+	it, and take a core from the threads rendering. The events of the
+	window are handled between two calls, it stays responsive.
+	Once the last tile is shown, the frame is done (see render_wait()).
+*/
+static int	display_hook(t_program_data *data)
+{
+	t_render_job	*job;
+	double			now;
+	int				done;
+
+	job = data->job;
+	now = time_now_ms();
+	done = __atomic_load_n(&job->done, __ATOMIC_ACQUIRE);
+	if (now < job->refresh || done == job->shown)
+		return (usleep(1000), 0);
+	job->refresh = now + 1000.0 / DISPLAY_HZ;
+	if (job->shown == 0)
+		job->first_ms = now - job->start;
+	job->shown = done;
+	mlx_put_image_to_window(data->mlx->mlx_ptr, data->mlx->win_ptr,
+		data->mlx->img_ptr, 0, 0);
+	if (done == job->tiles)
+		render_wait(data);
+	return (0);
+}
+
+/* render_progressive()
+	Starts rendering the image in the background (see render_start()),
+	and shows it in the window as it goes, from display_hook(), run by
+	mlx_loop() between the events of the window.
+	If the job can't be allocated, the frame is rendered before the window
+	shows it, as render() does.
+*/
+void	render_progressive(t_program_data *data)
+{
+	t_render_job	*job;
+
+	job = aligned_alloc(64, sizeof(t_render_job));
+	if (!job)
+	{
+		render(data->scene, data->mlx);
+		mlx_put_image_to_window(data->mlx->mlx_ptr, data->mlx->win_ptr,
+			data->mlx->img_ptr, 0, 0);
+		return ;
+	}
+	job->shown = 0;
+	job->refresh = 0.0;
+	job->first_ms = 0.0;
+	data->job = job;
+	setup_camera(&data->scene->camera, data->scene->width,
+		data->scene->height);
+	render_start(job, data->scene, data->mlx, 1);
+	mlx_loop_hook(data->mlx->mlx_ptr, display_hook, data);
+}
+
+/* render_wait()
+	Waits for the frame rendering in the background, if any (see
+	render_finish()), then frees it and removes display_hook(): mlx_loop()
+	goes back to waiting for events. The render time and the time until
+	the first tiles were shown are printed on stdout, or the tiles done if
+	the frame was cancelled.
+*/
+void	render_wait(t_program_data *data)
+{
+	t_render_job	*job;
+
+	job = data->job;
+	if (!job)
+		return ;
+	render_finish(job);
+	if (job->done < job->tiles)
+		printf("render:  cancelled after %.1f ms, %d of %d tiles done\n",
+			render_stats()->ms, job->done, job->tiles);
+	else
+		printf("render:  %.1f ms on %d threads, first tiles shown after "
+			"%.1f ms\n", render_stats()->ms, job->count, job->first_ms);
+	mlx_loop_hook(data->mlx->mlx_ptr, NULL, NULL);
+	free(job);
+	data->job = NULL;
+}
+
+/* render_cancel()
+	Stops the frame rendering in the background, if any: the threads are
+	done once they finish the tile they are on, render_wait() waits for
+	them. ESC or closing the window in the middle of a frame exit at once
+	(see cleanup()), not once the frame is done.
+*/
+void	render_cancel(t_program_data *data)
+{
+	if (data->job)
+		__atomic_store_n(&data->job->cancel, 1, __ATOMIC_RELEASE);
+	render_wait(data);
+}
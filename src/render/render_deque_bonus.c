@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_deque_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:47:20 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:52:55 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* deque_pop()
+	Takes the tile at the front of the deque of w, that of the calling
+	thread: the compare and swap fails if another thread stole from it in
+	the meantime, and the thread tries again with what is left.
+	Return the position of the tile in the order, -1 if the deque is empty
+*/
+int	deque_pop(t_render_worker *w)
+{
+	unsigned long	range;
+	unsigned long	head;
+
+	range = __atomic_load_n(&w->range, __ATOMIC_ACQUIRE);
+	head = range >> 32;
+	while (head < (range & 0xFFFFFFFFul))
+	{
+		if (__atomic_compare_exchange_n(&w->range, &range, range + (1ul << 32),
+				0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return ((int)head);
+		head = range >> 32;
+	}
+	return (-1);
+}
+
+/* steal_from()
+	Takes the back half of the tiles left in the deque of the victim v
+	(the one tile left, if that's all there is) for the calling thread,
+	whose deque is empty: the tiles leave v by a compare and swap, then
+	become the deque of w. No other thread can take from the deque of w
+	before that, as it is empty: a thread stealing looks for tiles left.
+	Return 1 if tiles were stolen, 0 if v has none left
+*/
+static int	steal_from(t_render_worker *w, t_render_worker *v)
+{
+	unsigned long	range;
+	unsigned long	head;
+	unsigned long	end;
+	unsigned long	half;
+
+	range = __atomic_load_n(&v->range, __ATOMIC_ACQUIRE);
+	head = range >> 32;
+	end = range & 0xFFFFFFFFul;
+	while (head < end)
+	{
+		half = (end - head + 1) / 2;
+		if (__atomic_compare_exchange_n(&v->range, &range,
+				(head << 32) | (end - half), 0, __ATOMIC_ACQ_REL,
+				__ATOMIC_ACQUIRE))
+		{
+			__atomic_store_n(&w->range, ((end - half) << 32) | end,
+				__ATOMIC_RELEASE);
+			w->steals++;
+			return (1);
+		}
+		head = range >> 32;
+		end = range & 0xFFFFFFFFul;
+	}
+	return (0);
+}
+
+/* deque_steal()
+	When the deque of w runs dry: steals tiles from the first of the other
+	threads that has some left, starting with the next one, so that the
+	thieves spread over their victims.
+	Return 1 if tiles were stolen, 0 if none are left anywhere: the frame
+	is done, but for the tiles the other threads are rendering
+*/
+int	deque_steal(t_render_worker *w)
+{
+	t_render_job	*job;
+	int				self;
+	int				i;
+
+	job = w->job;
+	self = w - job->workers;
+	i = 0;
+	while (++i < job->count)
+	{
+		if (steal_from(w, &job->workers[(self + i) % job->count]))
+			return (1);
+	}
+	return (0);
+}
+
+/* deque_share()
+	Starts the deques of the job->count threads of a frame: each gets its
+	share of the tiles, a stretch of the order as long as the others.
+*/
+void	deque_share(t_render_job *job)
+{
+	unsigned long	first;
+	unsigned long	end;
+	int				i;
+
+	i = -1;
+	while (++i < job->count)
+	{
+		first = (unsigned long)job->tiles * i / job->count;
+		end = (unsigned long)job->tiles * (i + 1) / job->count;
+		ft_bzero(&job->workers[i], sizeof(t_render_worker));
+		job->workers[i].range = (first << 32) | end;
+		job->workers[i].job = job;
+	}
+}
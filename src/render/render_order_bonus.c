@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_order_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:47:01 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:52:55 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* hilbert_cell()
+	The cell (x, y) at distance d along a Hilbert curve over a grid of
+	n x n cells (n a power of 2): each pair of bits of d picks a quadrant,
+	from the smallest to the largest, rotated and mirrored so that two
+	cells next to each other on the curve are neighbours in the grid.
+*/
+static void	hilbert_cell(int n, int d, int *x, int *y)
+{
+	int	s;
+	int	rx;
+	int	ry;
+	int	t;
+
+	*x = 0;
+	*y = 0;
+	s = 1;
+	while (s < n)
+	{
+		rx = 1 & (d / 2);
+		ry = 1 & (d ^ rx);
+		t = *x;
+		if (ry == 0)
+		{
+			*x = *y + rx * (s - 1 - 2 * *y);
+			*y = t + rx * (s - 1 - 2 * t);
+		}
+		*x += s * rx;
+		*y += s * ry;
+		d /= 4;
+		s *= 2;
+	}
+}
+
+/* tile_order()
+	The cols x rows tiles of an image (numbered row after row) along a
+	Hilbert curve over the smallest square grid of a power of 2 covering
+	them, skipping its cells outside the image. A stretch of the curve is
+	a compact patch of the image: the rays of a thread's tiles, or of the
+	tiles stolen from the end of its share, hit the same objects and walk
+	the same nodes of the BVH, which stay in its caches.
+	Return the malloc'ed order, NULL on allocation failure
+*/
+int	*tile_order(int cols, int rows)
+{
+	int	*order;
+	int	n;
+	int	d;
+	int	k;
+	int	xy[2];
+
+	order = malloc(sizeof(int) * cols * rows);
+	if (!order)
+		return (NULL);
+	n = 1;
+	while (n < cols || n < rows)
+		n *= 2;
+	k = 0;
+	d = -1;
+	while (++d < n * n)
+	{
+		hilbert_cell(n, d, &xy[0], &xy[1]);
+		if (xy[0] < cols && xy[1] < rows)
+			order[k++] = xy[1] * cols + xy[0];
+	}
+	return (order);
+}
+
+// CPU time of the calling thread in milliseconds: unlike the wall clock,
+// it doesn't count the time the thread waited for a core
+double	thread_time_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6);
+}
+
+// the share of the tiles of the last frame rendered by render_tiles()
+t_render_stats	*render_stats(void)
+{
+	static t_render_stats	stats;
+
+	return (&stats);
+}
+
+/* render_stats_report()
+	Prints how the last frame was shared by the threads: the busy time of
+	each (CPU time spent on its tiles) and its tiles, the steals, and the
+	balance: the mean busy time over the longest one, 100% when all the
+	threads worked as long.
+*/
+void	render_stats_report(void)
+{
+	t_render_stats	*s;
+	double			max;
+	double			sum;
+	int				i;
+
+	s = render_stats();
+	printf("threads: %d, %d tiles, %d steals, %.1f ms frame, busy ms (tiles):",
+		s->threads, s->tiles, s->steals, s->ms);
+	max = 0.0;
+	sum = 0.0;
+	i = -1;
+	while (++i < s->threads)
+	{
+		printf(" %.1f (%d)", s->busy[i], s->done[i]);
+		max = fmax(max, s->busy[i]);
+		sum += s->busy[i];
+	}
+	if (max > 0.0)
+		printf(", balance %.0f%%", 100.0 * sum / s->threads / max);
+	printf("\n");
+}
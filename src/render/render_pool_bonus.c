@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_pool_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 03:02:09 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:13:29 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* pool_thread()
+	Thread routine of the pool: parked on pool->wake until a frame is
+	handed out, it takes the next worker of the job and renders its tiles
+	(see render_worker()), or does nothing if the job has no worker left
+	for it. Its counters went to w->stats, they start again from 0 for the
+	next frame. The last thread done with the frame signals pool->idle:
+	until then, pool->job stays the same.
+	Returns when pool->quit is set.
+*/
+static void	*pool_thread(void *arg)
+{
+	t_render_pool	*pool;
+	long			seen;
+	int				i;
+
+	pool = arg;
+	seen = 0;
+	pthread_mutex_lock(&pool->lock);
+	while (1)
+	{
+		while (!pool->quit && pool->frame == seen)
+			pthread_cond_wait(&pool->wake, &pool->lock);
+		if (pool->quit)
+			break ;
+		seen = pool->frame;
+		pthread_mutex_unlock(&pool->lock);
+		i = __atomic_fetch_add(&pool->job->next_worker, 1, __ATOMIC_RELAXED);
+		if (i < pool->job->count)
+			render_worker(&pool->job->workers[i]);
+		ft_bzero(prim_stats(), sizeof(t_prim_stats));
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->busy == 0)
+			pthread_cond_signal(&pool->idle);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return (NULL);
+}
+
+/* pool_create()
+	Starts the threads rendering the frames, once for all of them: they
+	wait for a frame between two, instead of being started and joined for
+	each one. A thread that can't be started leaves its share of the work
+	to the others, and to the thread rendering with them, if any.
+	Return the pool, NULL on allocation failure
+*/
+t_render_pool	*pool_create(int threads)
+{
+	t_render_pool	*pool;
+
+	pool = malloc(sizeof(t_render_pool));
+	if (!pool)
+		return (NULL);
+	pool->count = 0;
+	pool->job = NULL;
+	pool->frame = 0;
+	pool->busy = 0;
+	pool->quit = 0;
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	pthread_cond_init(&pool->idle, NULL);
+	while (pool->count < min(threads, RT_MAX_THREADS)
+		&& pthread_create(&pool->tids[pool->count], NULL, pool_thread,
+			pool) == 0)
+		pool->count++;
+	return (pool);
+}
+
+/* pool_dispatch()
+	Hands the workers job->workers[job->next_worker...] out to the threads
+	of the pool, and wakes them up; render_finish() waits for them with
+	pool_wait().
+	Return 1 if the threads got the job, 0 if there is no thread to take
+	it, or no worker for them
+*/
+int	pool_dispatch(t_render_pool *pool, t_render_job *job)
+{
+	if (!pool || pool->count == 0 || job->next_worker >= job->count)
+		return (0);
+	pthread_mutex_lock(&pool->lock);
+	pool->job = job;
+	pool->frame++;
+	pool->busy = pool->count;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	return (1);
+}
+
+// waits until the threads of the pool are done with the frame, if any
+void	pool_wait(t_render_pool *pool)
+{
+	if (!pool)
+		return ;
+	pthread_mutex_lock(&pool->lock);
+	while (pool->busy > 0)
+		pthread_cond_wait(&pool->idle, &pool->lock);
+	pool->job = NULL;
+	pthread_mutex_unlock(&pool->lock);
+}
+
+/* pool_destroy()
+	Ends the threads of the pool, once done with their frame, joins them
+	and frees the pool
+*/
+void	pool_destroy(t_render_pool *pool)
+{
+	if (!pool)
+		return ;
+	pool_wait(pool);
+	pthread_mutex_lock(&pool->lock);
+	pool->quit = 1;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	while (pool->count > 0)
+		pthread_join(pool->tids[--pool->count], NULL);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->wake);
+	pthread_cond_destroy(&pool->idle);
+	free(pool);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_tiles_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:39:12 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:13:29 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// renders the tile i of the job, numbered row after row
+static void	render_tile(t_render_job *job, int i)
+{
+	int	x;
+	int	y;
+
+	x = i % job->cols * RENDER_TILE;
+	y = i / job->cols * RENDER_TILE;
+	render_rect(job->scene, job->mlx, (int [4]){x, y,
+		min(x + RENDER_TILE, job->scene->width),
+		min(y + RENDER_TILE, job->scene->height)});
+}
+
+/* render_worker()
+	Thread routine: renders the tiles of the deque of w from the front, then
+	steals more from the others (see deque_steal()) until none are left,
+	or until the job is cancelled: the flag is checked before each tile,
+	a thread stops within the time of one tile.
+	The tiles never share a pixel, and the rest of what the threads write
+	(the counters of prim_stats()) belongs to each thread: they are copied
+	into w->stats once the thread is done, with its CPU time.
+*/
+void	*render_worker(void *arg)
+{
+	t_render_worker	*w;
+	double			start;
+	int				i;
+
+	w = arg;
+	start = thread_time_ms();
+	while (!__atomic_load_n(&w->job->cancel, __ATOMIC_ACQUIRE))
+	{
+		i = deque_pop(w);
+		if (i < 0 && !deque_steal(w))
+			break ;
+		if (i < 0)
+			continue ;
+		if (w->job->order)
+			i = w->job->order[i];
+		render_tile(w->job, i);
+		w->tiles++;
+		__atomic_add_fetch(&w->job->done, 1, __ATOMIC_RELEASE);
+	}
+	w->busy = thread_time_ms() - start;
+	w->stats = *prim_stats();
+	return (NULL);
+}
+
+/* render_start()
+	Starts rendering the image on scene->threads threads: the image is cut
+	in tiles of RENDER_TILE x RENDER_TILE pixels, put in the order of a
+	Hilbert curve (see tile_order()), and each thread gets a stretch of
+	that order in its deque (see deque_share()). A thread that is done with
+	its own tiles steals half of those left to another one, so that none
+	waits while others still have expensive tiles (reflections, many
+	lights) to render. The image is the same whatever the thread count.
+	The threads are those of scene->pool, started once for all the frames
+	(see pool_create()). With `background` 0, the calling thread is one of
+	them, and the frame is done but for the tiles of the others when it
+	returns; otherwise all the threads run in the background, and
+	job->done counts the tiles rendered. Either way, render_finish() waits
+	for the threads; setting job->cancel stops them first (see
+	render_cancel()). Without a pool, the calling thread renders the frame.
+*/
+void	render_start(t_render_job *job, t_scene *scene, t_mlx_data *mlx,
+		int background)
+{
+	job->start = time_now_ms();
+	job->scene = scene;
+	job->mlx = mlx;
+	job->cols = (scene->width + RENDER_TILE - 1) / RENDER_TILE;
+	job->tiles = job->cols * ((scene->height + RENDER_TILE - 1)
+			/ RENDER_TILE);
+	job->order = tile_order(job->cols, job->tiles / job->cols);
+	job->count = min(scene->threads, job->tiles);
+	job->done = 0;
+	job->cancel = 0;
+	deque_share(job);
+	job->first = (background == 0);
+	job->next_worker = job->first;
+	if (!pool_dispatch(scene->pool, job))
+		job->first = 1;
+	if (job->first)
+		render_worker(&job->workers[0]);
+}
+
+/* render_finish()
+	Waits for the threads of the job, adds their counters to those of the
+	calling thread (see prim_stats_add()) and records how they shared the
+	frame in render_stats(). The workers left to a thread of the pool that
+	couldn't be started have no counters: their tiles were stolen.
+*/
+void	render_finish(t_render_job *job)
+{
+	t_render_stats	*stats;
+	int				i;
+
+	pool_wait(job->scene->pool);
+	stats = render_stats();
+	stats->threads = job->count;
+	stats->tiles = job->tiles;
+	stats->steals = 0;
+	stats->ms = time_now_ms() - job->start;
+	i = -1;
+	while (++i < job->count)
+	{
+		if (i >= job->first)
+			prim_stats_add(&job->workers[i].stats);
+		stats->steals += job->workers[i].steals;
+		stats->busy[i] = job->workers[i].busy;
+		stats->done[i] = job->workers[i].tiles;
+	}
+	free(job->order);
+	job->order = NULL;
+}
+
+// renders the whole image on scene->threads threads, see render_start()
+void	render_tiles(t_scene *scene, t_mlx_data *mlx)
+{
+	t_render_job	job;
+
+	render_start(&job, scene, mlx, 0);
+	render_finish(&job);
+}
@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/04 18:30:51 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/14 16:05:05 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/17 02:06:15 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -52,10 +52,10 @@ static t_color	ray_color(t_ray *ray, t_scene *scene)
 	t_hit_record	temp_rec;
 	t_object		*obj;
 	int				hit_anything;
-	double			closest_so_far;
+	t_real			closest_so_far;
 
 	hit_anything = 0;
-	closest_so_far = DBL_MAX;
+	closest_so_far = REAL_MAX;
 	obj = scene->objects;
 	while (obj)
 	{
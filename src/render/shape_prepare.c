@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shape_prepare.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:06:47 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 01:10:53 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* shape_prepare()
+	Computes once what the intersection routines would otherwise compute
+	again on every ray, from the parsed geometry of an object:
+	- sphere:	radius²
+	- cylinder:	radius² and the center of its top cap
+	- cone:		1 / cos² of its half angle, the center of its base cap
+				and the radius² of that cap (height² * tan²)
+	To be done again whenever the object moves (see prim_pack()).
+*/
+void	shape_prepare(t_object *obj)
+{
+	t_sphere	*sp;
+	t_cylinder	*cy;
+	t_cone		*co;
+
+	if (obj->type == SPHERE)
+	{
+		sp = obj->shape_data;
+		sp->radius_sq = sp->radius * sp->radius;
+	}
+	else if (obj->type == CYLINDER)
+	{
+		cy = obj->shape_data;
+		cy->radius_sq = (cy->diameter / 2.0) * (cy->diameter / 2.0);
+		cy->top = vec3_add(cy->center, vec3_mul(cy->axis, cy->height));
+	}
+	else if (obj->type == CONE)
+	{
+		co = obj->shape_data;
+		co->inv_cos_sq = 1.0 / co->cos_angle_sq;
+		co->cap_r_sq = co->height * co->height * (co->inv_cos_sq - 1.0);
+		co->base = vec3_add(co->tip, vec3_mul(co->axis, co->height));
+	}
+}
+
+// shape_prepare() for every object of a list
+void	shapes_prepare(t_object *objects)
+{
+	while (objects)
+	{
+		shape_prepare(objects);
+		objects = objects->next;
+	}
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cleanup_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:59:56 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:13:29 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* cleanup()
+	Frees all allocated resources in the reverse order of creation
+	and exits the program cleanly, once the threads rendering the frame
+	in the background have stopped (see render_cancel()), and the threads
+	of the pool are joined (see pool_destroy())
+	Without mlx_ptr the image is the headless buffer of --bench
+*/
+int	cleanup(t_program_data *data)
+{
+	if (!data)
+		exit(0);
+	render_cancel(data);
+	if (data->scene)
+		pool_destroy(data->scene->pool);
+	if (data->scene)
+		free_scene(data->scene);
+	if (data->mlx && !data->mlx->mlx_ptr)
+		free(data->mlx->addr);
+	else if (data->mlx)
+	{
+		if (data->mlx->img_ptr)
+			mlx_destroy_image(data->mlx->mlx_ptr, data->mlx->img_ptr);
+		if (data->mlx->win_ptr)
+			mlx_destroy_window(data->mlx->mlx_ptr, data->mlx->win_ptr);
+		mlx_destroy_display(data->mlx->mlx_ptr);
+		free(data->mlx->mlx_ptr);
+	}
+	free(data->mlx);
+	free(data);
+	exit(0);
+	return (0);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:59:56 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:45:36 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// --size WxH, e.g. --size 1920x1080
+static int	parse_size(char *str, t_options *opt)
+{
+	char	*x;
+
+	x = ft_strchr(str, 'x');
+	if (!x)
+		return (error_msg("--size: expected WxH"));
+	opt->width = ft_atoi(str);
+	opt->height = ft_atoi(x + 1);
+	if (opt->width <= 0 || opt->height <= 0)
+		return (error_msg("--size: width and height must be > 0"));
+	return (1);
+}
+
+/* parse_option()
+	Parses the option taking a value at argv[*i], the value is the next
+	argument (*i is advanced past it)
+	Return 1 on success, 0 on an unknown option or an invalid value
+*/
+static int	parse_option(int argc, char **argv, int *i, t_options *opt)
+{
+	char	*name;
+
+	name = argv[*i];
+	if (*i + 1 >= argc)
+		return (error_msg("Unknown option or missing value"));
+	(*i)++;
+	if (ft_strcmp(name, "--accel") == 0)
+		return (parse_accel(argv[*i], &opt->accel));
+	if (ft_strcmp(name, "--build") == 0)
+		return (parse_builder(argv[*i], &opt->builder));
+	if (ft_strcmp(name, "--size") == 0)
+		return (parse_size(argv[*i], opt));
+	if (ft_strcmp(name, "--stride") == 0)
+		return (parse_count(argv[*i], &opt->stride, "--stride: must be > 0"));
+	if (ft_strcmp(name, "--threads") == 0)
+		return (parse_count(argv[*i], &opt->threads, "--threads: must be > 0"));
+	if (ft_strcmp(name, "--animate") == 0)
+		return (parse_count(argv[*i], &opt->animate,
+				"--animate: frame count must be > 0"));
+	if (ft_strcmp(name, "--packet") == 0)
+		return (parse_packet(argv[*i], &opt->packet));
+	if (ft_strcmp(name, "--ppm") == 0 || ft_strcmp(name, "--diff") == 0)
+		return (parse_image_file(name, argv[*i], opt));
+	return (error_msg("Unknown option"));
+}
+
+/* parse_options()
+	./miniRTbonus <scene.rt>
+		[--accel linear|bvh|bvh4|bvh8|grid|hgrid|qbvh8|qbvh16]
+		[--build sah|lbvh|lbvh-opt] [--bench] [--size WxH]
+		[--animate N] [--stride K] [--no-cache] [--ppm FILE] [--diff FILE]
+		[--packet 1|2|4|8] [--threads N]
+	--threads also sets the threads building the BVH.
+	--animate, --ppm and --diff render headless, as --bench does.
+	The scene file comes first, the options may follow in any order.
+	Return 1 on success, 0 if the command line is invalid
+*/
+int	parse_options(int argc, char **argv, t_options *opt)
+{
+	int	i;
+
+	*opt = (t_options){0};
+	opt->accel = ACCEL_BVH;
+	opt->stride = ANIM_STRIDE;
+	opt->packet = PACKET_SIZE;
+	if (argc < 2)
+		return (0);
+	opt->scene_file = argv[1];
+	i = 2;
+	while (i < argc)
+	{
+		if (ft_strcmp(argv[i], "--bench") == 0)
+			opt->bench = 1;
+		else if (ft_strcmp(argv[i], "--no-cache") == 0)
+			opt->no_cache = 1;
+		else if (!parse_option(argc, argv, &i, opt))
+			return (0);
+		i++;
+	}
+	if (opt->animate)
+		opt->bench = 1;
+	return (1);
+}
+
+// number of worker threads: opt->threads, or one per online CPU if unset
+int	option_threads(t_options *opt)
+{
+	long	n;
+
+	if (opt->threads > 0)
+		return (min(opt->threads, RT_MAX_THREADS));
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n < 1)
+		return (1);
+	return ((int)min(n, RT_MAX_THREADS));
+}
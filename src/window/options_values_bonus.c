@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_values_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:24:58 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 02:19:59 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// --accel linear|bvh|bvh4|bvh8|grid|hgrid|qbvh8|qbvh16
+int	parse_accel(char *str, t_accel_kind *kind)
+{
+	if (ft_strcmp(str, "linear") == 0)
+		*kind = ACCEL_LINEAR;
+	else if (ft_strcmp(str, "bvh") == 0)
+		*kind = ACCEL_BVH;
+	else if (ft_strcmp(str, "bvh4") == 0)
+		*kind = ACCEL_BVH4;
+	else if (ft_strcmp(str, "bvh8") == 0)
+		*kind = ACCEL_BVH8;
+	else if (ft_strcmp(str, "grid") == 0)
+		*kind = ACCEL_GRID;
+	else if (ft_strcmp(str, "hgrid") == 0)
+		*kind = ACCEL_HGRID;
+	else if (ft_strcmp(str, "qbvh8") == 0)
+		*kind = ACCEL_QBVH8;
+	else if (ft_strcmp(str, "qbvh16") == 0)
+		*kind = ACCEL_QBVH16;
+	else
+		return (error_msg("--accel: expected linear, bvh, bvh4, bvh8, grid, "
+				"hgrid, qbvh8 or qbvh16"));
+	return (1);
+}
+
+// --build sah|lbvh|lbvh-opt
+int	parse_builder(char *str, t_bvh_builder *builder)
+{
+	if (ft_strcmp(str, "sah") == 0)
+		*builder = BUILD_SAH;
+	else if (ft_strcmp(str, "lbvh") == 0)
+		*builder = BUILD_LBVH;
+	else if (ft_strcmp(str, "lbvh-opt") == 0)
+		*builder = BUILD_LBVH_OPT;
+	else
+		return (error_msg("--build: expected sah, lbvh or lbvh-opt"));
+	return (1);
+}
+
+// a count > 0, e.g. --animate 100: prints `err` on anything else
+int	parse_count(char *str, int *count, char *err)
+{
+	*count = ft_atoi(str);
+	if (*count <= 0)
+		return (error_msg(err));
+	return (1);
+}
+
+// --ppm FILE, --diff FILE: both render headless, as --bench does
+int	parse_image_file(char *name, char *str, t_options *opt)
+{
+	opt->bench = 1;
+	if (ft_strcmp(name, "--ppm") == 0)
+		opt->ppm = str;
+	else
+		opt->diff = str;
+	return (1);
+}
+
+// --packet 1|2|4|8: the camera rays are traced in packets of N x N
+int	parse_packet(char *str, int *packet)
+{
+	*packet = ft_atoi(str);
+	if (*packet != 1 && *packet != 2 && *packet != 4 && *packet != 8)
+		return (error_msg("--packet: expected 1, 2, 4 or 8"));
+	return (1);
+}
@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/02 09:53:54 by anemet            #+#    #+#             */
-/*   Updated: 2025/10/02 10:24:24 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/16 22:59:37 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -60,13 +60,13 @@ static t_mlx_data	*init_mlx_data(t_scene *scene)
 	It orchestrates parsing the scene file and setting up the MLX window
 	and data structures.
 */
-t_program_data	*init_program_data(char *scene_file)
+t_program_data	*init_program_data(t_options *opt)
 {
 	t_program_data	*data;
 	t_scene			*scene;
 	t_mlx_data		*mlx;
 
-	scene = parse_scene(scene_file);
+	scene = parse_scene(opt->scene_file);
 	if (!scene)
 		return (NULL);
 	mlx = init_mlx_data(scene);
@@ -83,5 +83,6 @@ t_program_data	*init_program_data(char *scene_file)
 	}
 	data->scene = scene;
 	data->mlx = mlx;
+	data->opt = *opt;
 	return (data);
 }
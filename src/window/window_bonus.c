@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   window_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/16 22:59:55 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/17 03:29:06 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+/* my_put_pixel_to_img()
+	Calculates the memory offset for a pixel at (x, y) and sets its color.
+	This is the bridge between the renderer's color calculations and the
+	actual image buffer.
+*/
+void	my_put_pixel_to_img(t_mlx_data *data, int x, int y, int color)
+{
+	char	*dst;
+
+	if (!data || !data->addr)
+		return ;
+	dst = data->addr + (y * data->line_length + x * (data->bits_per_pixel / 8));
+	*(unsigned int *)dst = color;
+}
+
+/* init_mlx_data()
+	Initializes the MLX connection, creates a window,
+		and sets up an image buffer
+	Returns a pointer to the t_mlx_data struct on success, or NULL on failure.
+*/
+static t_mlx_data	*init_mlx_data(t_scene *scene)
+{
+	t_mlx_data	*mlx;
+
+	mlx = malloc(sizeof(t_mlx_data));
+	if (!mlx)
+		return (NULL);
+	mlx->mlx_ptr = mlx_init();
+	if (!mlx->mlx_ptr)
+		return (free(mlx), NULL);
+	mlx->win_ptr = mlx_new_window(mlx->mlx_ptr, scene->width, scene->height,
+			"miniRT");
+	if (!mlx->win_ptr)
+		return (free(mlx->mlx_ptr), free(mlx), NULL);
+	mlx->img_ptr = mlx_new_image(mlx->mlx_ptr, scene->width, scene->height);
+	if (!mlx->img_ptr)
+		return (mlx_destroy_window(mlx->mlx_ptr, mlx->win_ptr),
+			free(mlx->mlx_ptr), free(mlx), NULL);
+	mlx->addr = mlx_get_data_addr(mlx->img_ptr, &mlx->bits_per_pixel,
+			&mlx->line_length, &mlx->endian);
+	return (mlx);
+}
+
+/* init_headless()
+	--bench renders without any window (and without an X server): the image
+	is a plain malloc'd buffer with the same 32 bits per pixel layout as
+	the MLX image, so my_put_pixel_to_img() works unchanged.
+	The NULL mlx_ptr tells cleanup() to free the buffer itself.
+*/
+static t_mlx_data	*init_headless(t_scene *scene)
+{
+	t_mlx_data	*mlx;
+
+	mlx = ft_calloc(1, sizeof(t_mlx_data));
+	if (!mlx)
+		return (NULL);
+	mlx->bits_per_pixel = 32;
+	mlx->line_length = scene->width * 4;
+	mlx->addr = malloc(mlx->line_length * scene->height);
+	if (!mlx->addr)
+		return (free(mlx), NULL);
+	return (mlx);
+}
+
+/* init_scene_data()
+	Parses the scene and builds the acceleration structure, once, before
+	anything gets rendered (or maps both from the cache, see load_scene()),
+	compiles the lights for the shading (see light_compile()), then applies
+	the --size, --packet and --threads options.
+	The build time and size of the BVH are reported on stdout.
+*/
+static t_scene	*init_scene_data(t_options *opt)
+{
+	t_scene	*scene;
+
+	scene = load_scene(opt);
+	if (!scene)
+		return (NULL);
+	if (!light_compile(scene))
+		return (free_scene(scene), error_msg("Lights: allocation failed"),
+			NULL);
+	if (opt->width > 0 && opt->height > 0)
+	{
+		scene->width = opt->width;
+		scene->height = opt->height;
+	}
+	scene->packet = opt->packet;
+	scene->threads = option_threads(opt);
+	accel_report(scene);
+	return (scene);
+}
+
+/* init_program_data()
+	The main initialization function.
+	It orchestrates parsing the scene file, building the acceleration
+	structure and setting up the MLX window (or the headless image buffer
+	of --bench) and data structures, then starts the threads that will
+	render all the frames (see pool_create()). Without them, the frames are
+	rendered by the main thread. The counters of --bench are opened first,
+	to count these threads too.
+*/
+t_program_data	*init_program_data(t_options *opt)
+{
+	t_program_data	*data;
+	t_scene			*scene;
+	t_mlx_data		*mlx;
+
+	scene = init_scene_data(opt);
+	if (!scene)
+		return (NULL);
+	if (opt->bench)
+		mlx = init_headless(scene);
+	else
+		mlx = init_mlx_data(scene);
+	if (!mlx)
+		return (free_scene(scene), NULL);
+	data = malloc(sizeof(t_program_data));
+	if (!data)
+		return (free_scene(scene), free(mlx), NULL);
+	data->scene = scene;
+	data->mlx = mlx;
+	data->opt = *opt;
+	data->job = NULL;
+	if (opt->bench && !opt->animate)
+		perf_init(&data->perf);
+	scene->pool = pool_create(scene->threads);
+	return (data);
+}
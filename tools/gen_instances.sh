@@ -0,0 +1,57 @@
+#!/bin/sh
+# Generates a scene made of many copies of one group of objects (bonus format)
+#	usage: tools/gen_instances.sh <instance count> [seed] [flat] > big.rt
+# The group (30 spheres, cylinders and cones) is defined once and placed
+# with `I` lines, at random positions and scales on a square whose side
+# grows with the square root of the count. With `flat`, every copy is
+# written out object by object instead: the same image (up to the rounding
+# of the coordinates), without instancing.
+
+N=${1:-1000}
+SEED=${2:-42}
+FLAT=${3:-}
+
+awk -v n="$N" -v seed="$SEED" -v flat="$FLAT" '
+function obj(k, x, y, z, s) {
+	if (type[k] == "sp")
+		printf "sp %.4f,%.4f,%.4f %.4f %s 0.5 30\n", x + px[k] * s,
+			y + py[k] * s, z + pz[k] * s, size[k] * s, col[k];
+	else if (type[k] == "cy")
+		printf "cy %.4f,%.4f,%.4f 0,1,0 %.4f %.4f %s 0.5 30\n",
+			x + px[k] * s, y + py[k] * s, z + pz[k] * s, size[k] * s,
+			2 * size[k] * s, col[k];
+	else
+		printf "co %.4f,%.4f,%.4f 0,-1,0 20 %.4f %s 0.5 30\n",
+			x + px[k] * s, y + py[k] * s, z + pz[k] * s, size[k] * s, col[k];
+}
+BEGIN {
+	srand(seed);
+	side = 6 * sqrt(n);
+	printf "A 0.2 255,255,255\n";
+	printf "C 0,%.2f,%.2f 0,-0.5,-0.866 70\n", side * 0.5, side * 0.6;
+	printf "L %.2f,%.2f,%.2f 0.7 255,255,255\n", -side, side, side;
+	printf "pl 0,0,0 0,1,0 200,200,200 0.2 10 1 60,60,60 0.5\n";
+	for (k = 0; k < 30; k++) {
+		t = rand();
+		type[k] = (t < 0.6) ? "sp" : (t < 0.85) ? "cy" : "co";
+		px[k] = (rand() - 0.5) * 4; py[k] = 1 + rand() * 2;
+		pz[k] = (rand() - 0.5) * 4; size[k] = 0.3 + rand() * 0.4;
+		col[k] = sprintf("%d,%d,%d", 55 + rand() * 200, 55 + rand() * 200,
+			55 + rand() * 200);
+	}
+	if (flat == "") {
+		printf "G cluster\n";
+		for (k = 0; k < 30; k++)
+			obj(k, 0, 0, 0, 1);
+		printf "E\n";
+	}
+	for (i = 0; i < n; i++) {
+		x = (rand() - 0.5) * side; z = -rand() * side;
+		s = 0.5 + rand();
+		if (flat == "")
+			printf "I cluster %.4f,0,%.4f 0,1,0 %.4f\n", x, z, s;
+		else
+			for (k = 0; k < 30; k++)
+				obj(k, x, 0, z, s);
+	}
+}'
@@ -0,0 +1,34 @@
+#!/bin/sh
+# Generates a particle scene: many small spheres of the same size
+#	usage: tools/gen_particles.sh <sphere count> [seed] [sparse] > p.rt
+# The spheres fill a cube uniformly, about one per 2x2x2 units. With
+# `sparse`, they are packed in 8 such cubes scattered in a volume 30 times
+# wider: small dense clusters in a lot of empty space, the worst case of a
+# uniform grid (compare --accel grid and hgrid).
+
+N=${1:-10000}
+SEED=${2:-42}
+SPARSE=${3:-}
+
+awk -v n="$N" -v seed="$SEED" -v sparse="$SPARSE" '
+function sphere(x, y, z) {
+	printf "sp %.4f,%.4f,%.4f 0.6 %d,%d,%d 0.5 30\n", x, y, z,
+		55 + rand() * 200, 55 + rand() * 200, 55 + rand() * 200;
+}
+BEGIN {
+	srand(seed);
+	clusters = (sparse == "") ? 1 : 8;
+	side = 2 * exp(log(n / clusters) / 3);
+	world = (sparse == "") ? 0 : 30 * side;
+	printf "A 0.2 255,255,255\n";
+	printf "C 0,0,%.2f 0,0,-1 60\n", (side + world) * 1.2;
+	printf "L %.2f,%.2f,%.2f 0.7 255,255,255\n", -side - world,
+		side + world, side + world;
+	for (c = 0; c < clusters; c++) {
+		cx = (rand() - 0.5) * world; cy = (rand() - 0.5) * world * 0.5;
+		cz = (rand() - 0.5) * world;
+		for (i = c * int(n / clusters); i < (c + 1) * int(n / clusters); i++)
+			sphere(cx + (rand() - 0.5) * side, cy + (rand() - 0.5) * side,
+				cz + (rand() - 0.5) * side);
+	}
+}'
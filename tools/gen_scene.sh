@@ -0,0 +1,38 @@
+#!/bin/sh
+# Generates a large random .rt scene (bonus format) for benchmarking
+#	usage: tools/gen_scene.sh <object count> [seed] > scenes/big.rt
+# The objects (70% spheres, 20% cylinders, 10% cones) are scattered in a
+# cube whose side grows with the cube root of the count, so the density
+# stays the same, above a checkered floor plane.
+
+N=${1:-1000}
+SEED=${2:-42}
+
+awk -v n="$N" -v seed="$SEED" 'BEGIN {
+	srand(seed);
+	side = 4 * exp(log(n) / 3);
+	printf "A 0.2 255,255,255\n";
+	printf "C 0,%.2f,%.2f 0,-0.3,-1 70\n", side * 0.6, side * 1.6;
+	printf "L %.2f,%.2f,%.2f 0.7 255,255,255\n", -side, side, side;
+	printf "L %.2f,%.2f,%.2f 0.5 255,200,150\n", side, side * 0.5, side;
+	printf "pl 0,%.2f,0 0,1,0 200,200,200 0.2 10 1 60,60,60 0.5\n", \
+		-side / 2 - 1;
+	for (i = 0; i < n; i++) {
+		x = (rand() - 0.5) * side; y = (rand() - 0.5) * side;
+		z = (rand() - 0.5) * side - side / 2;
+		col = sprintf("%d,%d,%d", 55 + rand() * 200, 55 + rand() * 200,
+			55 + rand() * 200);
+		k = rand();
+		if (k < 0.7)
+			printf "sp %.3f,%.3f,%.3f %.3f %s 0.5 30\n", x, y, z,
+				0.5 + rand(), col;
+		else if (k < 0.9)
+			printf "cy %.3f,%.3f,%.3f %.3f,%.3f,%.3f %.3f %.3f %s 0.5 30\n",
+				x, y, z, rand() - 0.5, rand(), rand() - 0.5, 0.3 + rand() * 0.5,
+				0.5 + rand(), col;
+		else
+			printf "co %.3f,%.3f,%.3f %.3f,%.3f,%.3f %.1f %.3f %s 0.5 30\n",
+				x, y, z, rand() - 0.5, -rand(), rand() - 0.5, 15 + rand() * 20,
+				0.5 + rand(), col;
+	}
+}'
@@ -0,0 +1,40 @@
+#!/bin/sh
+# Image-difference report of the float build against the double build
+#	usage: tools/precision_diff.sh [WxH] [scene.rt ...]
+# Builds miniRTbonus twice (make bonus PRECISION=float, then make bonus, so
+# the tree is left with the default double build), renders every scene (all
+# of scenes/ by default) with both at WxH (640x360 by default), saving the
+# double image with --ppm and comparing the float one with it through
+# --diff, and prints one line per scene: the render times, the largest and
+# mean channel difference, the share of pixels that differ (and differ
+# visibly, by more than DIFF_VISIBLE) and the PSNR.
+# Run it from the root of the repository.
+
+SIZE=${1:-640x360}
+[ $# -gt 0 ] && shift
+SCENES=${*:-scenes/*.rt}
+TMP=$(mktemp -d)
+
+build() {
+	find src -name '*.o' -delete
+	make -s bonus PRECISION="$1" > /dev/null || exit 1
+	cp miniRTbonus "$TMP/miniRT_$1"
+}
+
+build float
+build double
+printf '%-28s %9s %9s %4s %8s %8s %8s %9s\n' scene double float max \
+	mean differ visible PSNR
+for s in $SCENES; do
+	ppm="$TMP/$(basename "$s").ppm"
+	d=$("$TMP/miniRT_double" "$s" --size "$SIZE" --no-cache --ppm "$ppm")
+	f=$("$TMP/miniRT_float" "$s" --size "$SIZE" --no-cache --diff "$ppm")
+	echo "$d" "$f" | awk -v s="$(basename "$s")" '
+		/^render:/ { ms[n++] = $2 }
+		/^diff: .*max/ { max = $3 + 0; mean = $5; differ = $8;
+			visible = substr($11, 2) }
+		/^diff: .*PSNR/ { psnr = $3 }
+		END { printf "%-28s %7sms %7sms %4s %8s %8s %8s %6s dB\n", s,
+			ms[0], ms[1], max, mean, differ, visible, psnr }'
+done
+rm -rf "$TMP"
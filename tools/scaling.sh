@@ -0,0 +1,49 @@
+#!/bin/sh
+# Strong-scaling report of the tile renderer
+#	usage: tools/scaling.sh [WxH] [max threads] [scene.rt ...]
+# Renders every scene (all of scenes/ by default) at WxH (640x360 by
+# default) with --threads 1, 2, 4, ... up to max threads (the online CPUs
+# by default), keeping the median render time of 3 runs, and prints one
+# line per run: the time, the speedup over 1 thread and the parallel
+# efficiency (speedup / threads). The image checksum has to be the same
+# whatever the thread count, a scene whose checksum changes is reported.
+# Run it from the root of the repository, after make bonus.
+
+SIZE=${1:-640x360}
+[ $# -gt 0 ] && shift
+MAX=${1:-$(getconf _NPROCESSORS_ONLN)}
+[ $# -gt 0 ] && shift
+SCENES=${*:-scenes/*.rt}
+
+# median render time and checksum of 3 runs of scene $1 on $2 threads
+run() {
+	for i in 1 2 3; do
+		./miniRTbonus "$1" --bench --no-cache --size "$SIZE" --threads "$2"
+	done | awk '
+		/^render:/ { ms[n++] = $2 }
+		/^image:/ { sum = $3 }
+		END { if (ms[0] > ms[1]) { t = ms[0]; ms[0] = ms[1]; ms[1] = t }
+			m = ms[1]; if (ms[2] < ms[0]) m = ms[0];
+			else if (ms[2] < ms[1]) m = ms[2];
+			print m, sum }'
+}
+
+printf '%-28s %7s %10s %8s %10s\n' scene threads render speedup efficiency
+for s in $SCENES; do
+	t=1
+	base=""
+	while [ "$t" -le "$MAX" ]; do
+		set -- $(run "$s" "$t")
+		[ -z "$base" ] && base=$1 && sum=$2
+		[ "$2" != "$sum" ] && echo "$(basename "$s"): checksum $2 with" \
+			"$t threads, $sum with 1"
+		echo "$1 $base" | awk -v s="$(basename "$s")" -v t="$t" '
+			{ printf "%-28s %7d %8.1fms %7.2fx %9.0f%%\n", s, t, $1,
+				$2 / $1, 100 * $2 / $1 / t }'
+		if [ "$t" -lt "$MAX" ] && [ $((t * 2)) -gt "$MAX" ]; then
+			t=$MAX
+		else
+			t=$((t * 2))
+		fi
+	done
+done